@@ -0,0 +1,180 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_ReplayApp.hpp
+ *
+ */
+
+#ifndef PLATO_REPLAYAPP_HPP_
+#define PLATO_REPLAYAPP_HPP_
+
+#include <map>
+#include <mpi.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "Plato_SharedData.hpp"
+#include "Plato_Application.hpp"
+#include "Plato_StageRecorder.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+//!  Stand-in for a hosted code that replays a performer's recorded behavior
+/*!
+ Each operation waits for its recorded mean duration instead of computing, scaled by
+ the given factor (by default the recorded rank count of the performer over the
+ current one).  Shared data is exported from and imported into buffers of the
+ right size, and the field layouts own the recorded number of global IDs,
+ split in contiguous blocks over the performer's ranks.
+ */
+/******************************************************************************/
+class ReplayApp : public Plato::Application
+{
+public:
+    ReplayApp(const Plato::StageRecording & aRecording,
+              const std::string & aPerformerName,
+              const MPI_Comm & aLocalComm,
+              double aComputeScale = -1) :
+            mRecording(aRecording),
+            mPerformerName(aPerformerName),
+            mLocalComm(aLocalComm),
+            mComputeScale(aComputeScale),
+            mBuffers()
+    {
+        if(mComputeScale < 0)
+        {
+            int tNumRanks = 1;
+            MPI_Comm_size(mLocalComm, &tNumRanks);
+            auto tRecordedRanks = mRecording.mPerformerRanks.find(mPerformerName);
+            const int tNumRecordedRanks = tRecordedRanks != mRecording.mPerformerRanks.end() ? tRecordedRanks->second : tNumRanks;
+            mComputeScale = static_cast<double>(tNumRecordedRanks) / tNumRanks;
+        }
+    }
+    virtual ~ReplayApp()
+    {
+    }
+
+    /****************************************************************************************/
+    void finalize()
+    /****************************************************************************************/
+    {
+    }
+    /****************************************************************************************/
+    void initialize()
+    /****************************************************************************************/
+    {
+    }
+    /****************************************************************************************/
+    void compute(const std::string & aOperationName)
+    /****************************************************************************************/
+    {
+        auto tPerformer = mRecording.mComputeTimes.find(mPerformerName);
+        if(tPerformer == mRecording.mComputeTimes.end())
+        {
+            return;
+        }
+        auto tTimes = tPerformer->second.find(aOperationName);
+        if(tTimes == tPerformer->second.end())
+        {
+            return;
+        }
+
+        const double tSeconds = mComputeScale * tTimes->second.mean();
+        std::this_thread::sleep_for(std::chrono::duration<double>(tSeconds));
+    }
+    /****************************************************************************************/
+    void exportData(const std::string & aArgumentName, Plato::SharedData & aExportData)
+    /****************************************************************************************/
+    {
+        std::vector<double> & tBuffer = mBuffers[aArgumentName];
+        tBuffer.resize(aExportData.size(), 1.0);
+        aExportData.setData(tBuffer);
+    }
+    /****************************************************************************************/
+    void importData(const std::string & aArgumentName, const Plato::SharedData & aImportData)
+    /****************************************************************************************/
+    {
+        std::vector<double> & tBuffer = mBuffers[aArgumentName];
+        tBuffer.resize(aImportData.size());
+        aImportData.getData(tBuffer);
+    }
+    /****************************************************************************************/
+    void exportDataMap(const Plato::data::layout_t & aDataLayout, std::vector<int> & aMyOwnedGlobalIDs)
+    /****************************************************************************************/
+    {
+        auto tGlobalIDs = mRecording.mGlobalIDs.find(Plato::recording_layout_name(aDataLayout));
+        const long tNumGlobalIDs = tGlobalIDs != mRecording.mGlobalIDs.end() ? tGlobalIDs->second : 0;
+
+        int tMyRank = 0;
+        int tNumRanks = 1;
+        MPI_Comm_rank(mLocalComm, &tMyRank);
+        MPI_Comm_size(mLocalComm, &tNumRanks);
+        const long tBegin = tNumGlobalIDs * tMyRank / tNumRanks;
+        const long tEnd = tNumGlobalIDs * (tMyRank + 1) / tNumRanks;
+
+        aMyOwnedGlobalIDs.clear();
+        for(long tID = tBegin; tID < tEnd; tID++)
+        {
+            aMyOwnedGlobalIDs.push_back(static_cast<int>(tID));
+        }
+    }
+
+private:
+    const Plato::StageRecording & mRecording;
+    std::string mPerformerName;
+    MPI_Comm mLocalComm;
+    double mComputeScale;
+    std::map<std::string, std::vector<double>> mBuffers;
+
+private:
+    ReplayApp(const Plato::ReplayApp & aRhs);
+    Plato::ReplayApp & operator=(const Plato::ReplayApp & aRhs);
+};
+
+} // namespace Plato
+
+#endif /* PLATO_REPLAYAPP_HPP_ */
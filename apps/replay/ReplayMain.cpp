@@ -0,0 +1,174 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * ReplayMain.cpp
+ *
+ *  Plays back a stage recording written by an engine run with <Record> enabled.
+ *  Launch it like the recorded run, with the same interface definition and one
+ *  PLATO_PERFORMER_ID per performer, on any number of ranks:
+ *
+ *    mpirun -np 1 -x PLATO_PERFORMER_ID=0 -x PLATO_INTERFACE_FILE=interface.xml PlatoReplay recording.txt \
+ *         : -np 8 -x PLATO_PERFORMER_ID=1 -x PLATO_INTERFACE_FILE=interface.xml PlatoReplay recording.txt
+ *
+ *  An optional second argument sets the factor applied to the recorded compute times.
+ */
+
+#include "Plato_ReplayApp.hpp"
+#include "Plato_Interface.hpp"
+#include "Plato_StageRecorder.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <Teuchos_ParameterList.hpp>
+
+void safeExit(int aStatus){
+    MPI_Finalize();
+    exit(aStatus);
+}
+
+/******************************************************************************/
+int main(int aArgc, char **aArgv)
+/******************************************************************************/
+{
+    MPI_Init(&aArgc, &aArgv);
+
+    int tMyRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    if(aArgc < 2)
+    {
+        if(tMyRank == 0)
+        {
+            std::cerr << "usage: PlatoReplay <recording file> [compute scale]" << std::endl;
+        }
+        safeExit(1);
+    }
+
+    Plato::StageRecording tRecording;
+    try
+    {
+        tRecording.read(aArgv[1]);
+    }
+    catch(const Plato::ParsingException & tError)
+    {
+        std::cerr << tError.message() << std::endl;
+        safeExit(1);
+    }
+    const double tComputeScale = aArgc > 2 ? std::atof(aArgv[2]) : -1;
+
+    /************************* CREATE PLATO INTERFACE *************************/
+    Plato::Interface* tPlatoInterface = nullptr;
+    try
+    {
+        tPlatoInterface = new Plato::Interface();
+    }
+    catch(...)
+    {
+        safeExit(1);
+    }
+    /************************* CREATE PLATO INTERFACE *************************/
+
+    MPI_Comm tLocalComm;
+    tPlatoInterface->getLocalComm(tLocalComm);
+    const std::string tPerformerName = tPlatoInterface->getLocalPerformerName();
+
+    /************************ CREATE LOCAL APPLICATION ************************/
+    Plato::ReplayApp tMyApp(tRecording, tPerformerName, tLocalComm, tComputeScale);
+    try
+    {
+        tPlatoInterface->registerPerformer(&tMyApp);
+    }
+    catch(...)
+    {
+        safeExit(1);
+    }
+    /************************ CREATE LOCAL APPLICATION ************************/
+
+    /******************************** REPLAY **********************************/
+    try
+    {
+        if(tPerformerName == tRecording.mDriver)
+        {
+            // the driver's ranks issue the recorded stages in place of the optimizer
+            std::map<std::string, std::vector<double>> tBuffers;
+            Teuchos::ParameterList tArguments;
+            for(const Plato::StageRecording::Field & tField : tRecording.mFields)
+            {
+                std::vector<double> & tBuffer = tBuffers[tField.mName];
+                tBuffer.resize(tPlatoInterface->size(tField.mName), 1.0);
+                tArguments.set(tField.mName, tBuffer.data());
+            }
+
+            const double tBegin = MPI_Wtime();
+            for(const Plato::StageRecording::StageRun & tRun : tRecording.mStages)
+            {
+                for(int tRepeat = 0; tRepeat < tRun.mRepeats; tRepeat++)
+                {
+                    tPlatoInterface->compute(tRun.mName, tArguments);
+                }
+            }
+            const double tWallTime = MPI_Wtime() - tBegin;
+            tPlatoInterface->compute("Terminate", tArguments);
+
+            if(tMyRank == 0)
+            {
+                std::cout << "Replayed " << tRecording.numStages() << " stages in " << tWallTime << " s" << std::endl;
+            }
+        }
+        else
+        {
+            tPlatoInterface->perform();
+        }
+        tPlatoInterface->handleExceptions();
+    }
+    catch(...)
+    {
+        std::cerr << "PlatoReplay: replay of '" << aArgv[1] << "' failed on rank " << tMyRank << "." << std::endl;
+        safeExit(1);
+    }
+    /******************************** REPLAY **********************************/
+
+    delete tPlatoInterface;
+
+    safeExit(0);
+
+} // ReplayMain
@@ -42,6 +42,10 @@
 
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #ifdef ENABLE_ISO
 #include "STKExtract.hpp"
@@ -52,6 +56,8 @@
 #include <stk_mesh/base/Field.hpp>
 #include <stk_io/StkMeshIoBroker.hpp>
 #include <stk_mesh/base/CoordinateSystems.hpp>
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/FieldParallel.hpp>
 #endif
 
 #include "PlatoApp.hpp"
@@ -59,6 +65,7 @@
 #include "Plato_Exceptions.hpp"
 #include "Plato_SharedData.hpp"
 #include "Plato_PenaltyModel.hpp"
+#include "Plato_FieldAggregation.hpp"
 #include "PlatoEngine_FilterFactory.hpp"
 #include "PlatoEngine_AbstractFilter.hpp"
 #include "Ioss_Region.h"                // for Region, NodeSetContainer, etc
@@ -91,6 +98,20 @@ Plato::data::layout_t getLayout(Plato::InputData& aNode);
 /******************************************************************************/
 Plato::data::layout_t getLayout(const std::string & aLayoutStr);
 
+/******************************************************************************/
+/*! \brief List the files in the working directory.
+ *  Returns the names that begin with aPrefix and end with aSuffix, sorted by name.
+ */
+/******************************************************************************/
+std::vector<std::string> listFiles(const std::string & aPrefix, const std::string & aSuffix);
+
+/******************************************************************************/
+/*! \brief Write last_time_step.txt.
+ *  The file holds aTimeStep followed by the Iteration*.exo files in the working directory.
+ */
+/******************************************************************************/
+void writeLastTimeStep(const std::string & aTimeStep);
+
 /******************************************************************************/
 void PlatoApp::SetLowerBounds::getArguments(std::vector<LocalArg> & aLocalArgs)
 /******************************************************************************/
@@ -1389,6 +1410,11 @@ PlatoApp::Aggregator::Aggregator(PlatoApp* aPlatoApp, Plato::InputData& aNode) :
         }
         tNewAggStruct.layout = getLayout(tNode);
 
+        if( tNewAggStruct.inputNames.size() > m_weights.size() )
+        {
+            throw ParsingException("PlatoApp::Aggregator: fewer Weights than Inputs specified.");
+        }
+
         m_aggStructs.push_back(tNewAggStruct);
     }
 }
@@ -1947,18 +1973,14 @@ void PlatoApp::Aggregator::operator()()
       int dataLen = field.MyLength();
   
       int nvals = agg.inputNames.size();
-      std::vector<double*> fromData(nvals);
+      std::vector<const double*> fromData(nvals);
       for(int ival=0; ival<nvals; ival++){
         auto pfield = mPlatoApp->getNodeField(agg.inputNames[ival]);
-        pfield->ExtractView(&fromData[ival]);
+        double* tView; pfield->ExtractView(&tView);
+        fromData[ival] = tView;
       }
   
-      for(int i=0; i<dataLen; i++){
-        toData[i] = 0.0;
-        for(int j=0; j<nvals; j++){
-          toData[i] += fromData[j][i]*weights[j];
-        }
-      }
+      Plato::aggregate(fromData, weights, dataLen, toData);
 
     } else
     if(agg.layout == Plato::data::layout_t::SCALAR){
@@ -1967,7 +1989,7 @@ void PlatoApp::Aggregator::operator()()
   
       unsigned int dataLen = 0;
       int nvals = agg.inputNames.size();
-      std::vector<double*> fromData(nvals);
+      std::vector<const double*> fromData(nvals);
 
       // read first input value
       std::vector<double>* v = mPlatoApp->getValue(agg.inputNames[0]);
@@ -1984,12 +2006,7 @@ void PlatoApp::Aggregator::operator()()
       }
   
       toData.resize(dataLen);
-      for(unsigned int i=0; i<dataLen; i++){
-        toData[i] = 0.0;
-        for(int j=0; j<nvals; j++){
-          toData[i] += fromData[j][i]*weights[j];
-        }
-      }
+      Plato::aggregate(fromData, weights, dataLen, toData.data());
 
     } else {
  
@@ -2072,6 +2089,46 @@ void PlatoApp::PlatoMainOutput::getArguments(std::vector<LocalArg>& aLocalArgs)
   aLocalArgs = m_outputData;
 }
 
+/******************************************************************************/
+std::vector<std::string> listFiles(const std::string & aPrefix, const std::string & aSuffix)
+/******************************************************************************/
+{
+    std::vector<std::string> tFiles;
+    DIR* tDirectory = opendir(".");
+    if(tDirectory == nullptr)
+    {
+        return tFiles;
+    }
+    while(struct dirent* tEntry = readdir(tDirectory))
+    {
+        const std::string tName(tEntry->d_name);
+        if(tName.size() >= aPrefix.size() + aSuffix.size()
+           && tName.compare(0, aPrefix.size(), aPrefix) == 0
+           && tName.compare(tName.size() - aSuffix.size(), aSuffix.size(), aSuffix) == 0)
+        {
+            tFiles.push_back(tName);
+        }
+    }
+    closedir(tDirectory);
+    std::sort(tFiles.begin(), tFiles.end());
+    return tFiles;
+}
+
+/******************************************************************************/
+void writeLastTimeStep(const std::string & aTimeStep)
+/******************************************************************************/
+{
+    std::ofstream tFile("last_time_step.txt");
+    if(tFile)
+    {
+        tFile << aTimeStep << "\n";
+        for(const std::string & tName : listFiles("Iteration", ".exo"))
+        {
+            tFile << tName << "\n";
+        }
+    }
+}
+
 /******************************************************************************/
 void PlatoApp::PlatoMainOutput::extract_iso_surface(int aIteration)
 /******************************************************************************/
@@ -2123,15 +2180,213 @@ void PlatoApp::PlatoMainOutput::extract_iso_surface(int aIteration)
     MPI_Comm_rank(mPlatoApp->mLocalComm, &my_rank);
     if(my_rank == 0)
     {
-        FILE *fp = fopen("last_time_step.txt", "w");
-        if(fp)
+        writeLastTimeStep(tmp_str);
+    }
+#endif
+}
+
+/******************************************************************************/
+void PlatoApp::PlatoMainOutput::save_levelset_history(int aIteration)
+/******************************************************************************/
+{
+    char tmp_str[200];
+    if(aIteration < 10)
+        sprintf(tmp_str, "00%d", aIteration);
+    else if(aIteration < 100)
+        sprintf(tmp_str, "0%d", aIteration);
+    else
+        sprintf(tmp_str, "%d", aIteration);
+    const std::string tTimeStep(tmp_str);
+
+    // Keep the newest IterationHistory file as this iteration's file and remove the rest.
+    const std::vector<std::string> tHistoryFiles = listFiles("IterationHistory", "");
+    std::string tLastHistFileName;
+    struct timespec tLastModified = {0, 0};
+    for(const std::string & tName : tHistoryFiles)
+    {
+        struct stat tStatus;
+        if(stat(tName.c_str(), &tStatus) != 0)
+            continue;
+        const struct timespec & tModified = tStatus.st_mtim;
+        if(tLastHistFileName.empty() || tModified.tv_sec > tLastModified.tv_sec
+           || (tModified.tv_sec == tLastModified.tv_sec && tModified.tv_nsec >= tLastModified.tv_nsec))
         {
-            fprintf(fp, "%s\n", tmp_str);
-            fclose(fp);
-            system("ls Iteration*.exo >> last_time_step.txt");
+            tLastHistFileName = tName;
+            tLastModified = tModified;
         }
     }
+
+    bool tIsSaved = true;
+    if(!tLastHistFileName.empty())
+    {
+        const std::string tNewFilename = "Iteration" + tTimeStep + ".exo";
+        if(std::rename(tLastHistFileName.c_str(), tNewFilename.c_str()) != 0)
+        {
+            // e.g. across file systems; copy it instead
+            std::ifstream tSource(tLastHistFileName.c_str(), std::ios::binary);
+            std::ofstream tTarget(tNewFilename.c_str(), std::ios::binary);
+            const bool tIsTargetOpen = tTarget.is_open();
+            // an empty history file copies to an empty file; streaming nothing would set failbit
+            if(tSource && tIsTargetOpen && tSource.peek() != std::ifstream::traits_type::eof())
+            {
+                tTarget << tSource.rdbuf();
+            }
+            tTarget.close();
+            if(!tSource || !tIsTargetOpen || !tTarget)
+            {
+                std::cout << "PlatoMainOutput: failed to save '" << tLastHistFileName << "' as '" << tNewFilename
+                          << "'; keeping the history files." << std::endl;
+                if(tIsTargetOpen)
+                {
+                    std::remove(tNewFilename.c_str());
+                }
+                tIsSaved = false;
+            }
+        }
+    }
+    if(tIsSaved)
+    {
+        for(const std::string & tName : tHistoryFiles)
+        {
+            std::remove(tName.c_str());
+        }
+    }
+    writeLastTimeStep(tTimeStep);
+}
+
+#ifdef STK_ENABLED
+/******************************************************************************/
+void Plato::copy_owned_node_values(stk::mesh::BulkData & aBulkData,
+                                   const stk::mesh::FieldBase & aNodeField,
+                                   const Epetra_BlockMap & aMap,
+                                   const double* aValues)
+/******************************************************************************/
+{
+    std::vector<stk::mesh::Entity> tNodes;
+    aBulkData.get_entities(stk::topology::NODE_RANK, aBulkData.mesh_meta_data().universal_part(), tNodes);
+    for(const stk::mesh::Entity & tNode : tNodes)
+    {
+        static_cast<double*>(stk::mesh::field_data(aNodeField, tNode))[0] = 0.0;
+    }
+
+    // aMap overlaps, so a shared node appears on each of its ranks; only its owner
+    // sets it, and the sum hands that value to the other ranks
+    const int tLength = aMap.NumMyElements();
+    for(int tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        stk::mesh::Entity tNode = aBulkData.get_entity(stk::topology::NODE_RANK, aMap.GID(tIndex));
+        if(aBulkData.is_valid(tNode) && aBulkData.bucket(tNode).owned())
+        {
+            static_cast<double*>(stk::mesh::field_data(aNodeField, tNode))[0] = aValues[tIndex];
+        }
+    }
+    stk::mesh::parallel_sum(aBulkData, {&aNodeField});
+}
+#endif // STK_ENABLED
+
+/******************************************************************************/
+struct PlatoApp::PlatoMainOutput::RestartMesh
+/******************************************************************************/
+{
+#ifdef STK_ENABLED
+    explicit RestartMesh(MPI_Comm aComm) :
+            mMetaData(),
+            mBulkData(mMetaData, aComm),
+            mBroker(aComm),
+            mDofs(nullptr)
+    {
+    }
+    stk::mesh::MetaData mMetaData;
+    stk::mesh::BulkData mBulkData;
+    stk::io::StkMeshIoBroker mBroker;
+    stk::mesh::Field<double>* mDofs;
 #endif
+};
+
+/******************************************************************************/
+void PlatoApp::PlatoMainOutput::write_restart_file(int aIteration)
+/******************************************************************************/
+{
+    // The restart file holds the optimization dofs at this iteration.  The values are
+    // taken from memory and written collectively to a single file, so no per-rank
+    // pieces have to be joined afterwards.
+    std::string tDofsName;
+    for(const LocalArg & tOutput : m_outputData)
+    {
+        std::string tName = tOutput.mName;
+        tName.erase(std::remove(tName.begin(), tName.end(), ' '), tName.end());
+        std::transform(tName.begin(), tName.end(), tName.begin(), ::tolower);
+        if(tName == "optimizationdofs" && tOutput.mLayout == Plato::data::layout_t::SCALAR_FIELD)
+        {
+            tDofsName = tOutput.mName;
+        }
+    }
+    if(tDofsName.empty())
+    {
+        return;
+    }
+
+#ifdef STK_ENABLED
+    if(!mRestartMesh)
+    {
+        // the plot file pieces have the same decomposition as the optimization dofs
+        std::string tInputFilename = "platomain.exo";
+        int tNumProcs = 0;
+        MPI_Comm_size(mPlatoApp->mLocalComm, &tNumProcs);
+        if(tNumProcs == 1)
+            tInputFilename += ".1.0";
+
+        mRestartMesh = std::make_shared<RestartMesh>(mPlatoApp->mLocalComm);
+        stk::io::StkMeshIoBroker & tBroker = mRestartMesh->mBroker;
+        tBroker.set_bulk_data(mRestartMesh->mBulkData);
+        tBroker.set_option_to_not_collapse_sequenced_fields();
+        tBroker.property_add(Ioss::Property("LOWER_CASE_VARIABLE_NAMES", "OFF"));
+        tBroker.add_mesh_database(tInputFilename, "exodus", stk::io::READ_MESH);
+        tBroker.create_input_mesh();
+        mRestartMesh->mDofs = &mRestartMesh->mMetaData.declare_field<stk::mesh::Field<double>>(stk::topology::NODE_RANK, "optimizationdofs", 1);
+        stk::mesh::put_field(*mRestartMesh->mDofs, mRestartMesh->mMetaData.universal_part());
+        tBroker.populate_bulk_data();
+        tBroker.property_add(Ioss::Property("COMPOSE_RESULTS", true));
+    }
+
+    DistributedVector & tField = *(mPlatoApp->getNodeField(tDofsName));
+    double* tValues;
+    tField.ExtractView(&tValues);
+    Plato::copy_owned_node_values(mRestartMesh->mBulkData, *mRestartMesh->mDofs,
+                                  tField.getAssemblyEpetraVector()->Map(), tValues);
+
+    std::stringstream tOutputFilename;
+    tOutputFilename << "restart_" << aIteration << ".exo";
+    stk::io::StkMeshIoBroker & tBroker = mRestartMesh->mBroker;
+    size_t tFileHandle = tBroker.create_output_mesh(tOutputFilename.str(), stk::io::WRITE_RESULTS);
+    tBroker.add_field(tFileHandle, *mRestartMesh->mDofs);
+    tBroker.begin_output_step(tFileHandle, aIteration);
+    tBroker.write_defined_output_fields(tFileHandle);
+    tBroker.end_output_step(tFileHandle);
+    tBroker.close_output_mesh(tFileHandle);
+#else
+    // without STK, fall back to joining the plot file with the SEACAS tools
+    int tMyRank = 0;
+    MPI_Comm_rank(mPlatoApp->mLocalComm, &tMyRank);
+    if(tMyRank == 0)
+    {
+        std::ostringstream theCommand;
+        std::string tInputFilename = "platomain.exo.1.0";
+        int tNumProcs = 0;
+        MPI_Comm_size(mPlatoApp->mLocalComm, &tNumProcs);
+        if(tNumProcs > 1)
+        {
+            theCommand << "epu -auto platomain.exo." << tNumProcs << ".0 > epu.txt;";
+            tInputFilename = "platomain.exo";
+        }
+        theCommand << "echo times " << aIteration << " > commands.txt;";
+        theCommand << "echo save optimizationdofs >> commands.txt;";
+        theCommand << "echo end >> commands.txt;";
+        theCommand << "algebra " << tInputFilename << " restart_" << aIteration << ".exo < commands.txt > algebra.txt";
+        std::cout << "\nExecuting system call: " << theCommand.str() << "\n";
+        system(theCommand.str().c_str());
+    }
+#endif // STK_ENABLED
 }
 
 /******************************************************************************/
@@ -2159,61 +2414,13 @@ void PlatoApp::PlatoMainOutput::operator()()
             extract_iso_surface(int_time);
 
             // Write restart file
-            if(tMyRank == 0)
-            {
-                std::ostringstream theCommand;
-                std::string tInputFilename = "platomain.exo.1.0";
-                int tNumProcs = 0;
-                MPI_Comm_size(mPlatoApp->mLocalComm, &tNumProcs);
-                if(tNumProcs > 1)
-                {
-                    theCommand << "epu -auto platomain.exo." << tNumProcs << ".0 > epu.txt;";
-                    tInputFilename = "platomain.exo";
-                }
-                theCommand << "echo times " << int_time << " > commands.txt;";
-                theCommand << "echo save optimizationdofs >> commands.txt;";
-                theCommand << "echo end >> commands.txt;";
-                theCommand << "algebra " << tInputFilename << " restart_" << int_time << ".exo < commands.txt > algebra.txt";
-                std::cout << "\nExecuting system call: " << theCommand.str() << "\n";
-                system(theCommand.str().c_str());
-            }
+            write_restart_file(int_time);
         }
         else if(mDiscretization == "levelset")
         {
             if(tMyRank == 0)
             {
-                std::string tListCommand = "ls -t IterationHistory* > junk.txt";
-                system(tListCommand.c_str());
-                FILE *fp = fopen("junk.txt", "r");
-                if(fp)
-                {
-                    char tLastHistFileName[200] = " ";
-                    fscanf(fp, "%s", tLastHistFileName);
-                    fclose(fp);
-                    std::string tNewFilename = "Iteration";
-                    char tmp_str[200];
-                    if(int_time < 10)
-                        sprintf(tmp_str, "00%d", int_time);
-                    else if(int_time < 100)
-                        sprintf(tmp_str, "0%d", int_time);
-                    else if(int_time < 1000)
-                        sprintf(tmp_str, "%d", int_time);
-                    tNewFilename += tmp_str;
-                    tNewFilename += ".exo";
-                    std::string tCopyCommand = "cp ";
-                    tCopyCommand += tLastHistFileName;
-                    tCopyCommand += " ";
-                    tCopyCommand += tNewFilename;
-                    system(tCopyCommand.c_str());
-                    system("rm -f IterationHistory*");
-                    fp = fopen("last_time_step.txt", "w");
-                    if(fp)
-                    {
-                        fprintf(fp, "%s\n", tmp_str);
-                        fclose(fp);
-                        system("ls Iteration*.exo >> last_time_step.txt");
-                    }
-                }
+                save_levelset_history(int_time);
             }
         }
     }
@@ -2378,8 +2585,9 @@ PlatoApp::PlatoApp(int aArgc, char **aArgv, MPI_Comm& aLocalComm) :
         mTimersTree(nullptr)
 /******************************************************************************/
 {
+    // input files are read once by the local root and broadcast to the other ranks.
     const char* input_char = getenv("PLATO_APP_FILE");
-    Plato::Parser* parser = new Plato::PugiParser();
+    Plato::Parser* parser = new Plato::PugiParser(mLocalComm);
     mAppfileData = parser->parseFile(input_char);
 
     // create the FEM utility object
@@ -2392,8 +2600,11 @@ PlatoApp::PlatoApp(int aArgc, char **aArgv, MPI_Comm& aLocalComm) :
     {
         tInputfile = "platomain.xml";
     }
-    mInputfileData = parser->parseFile(tInputfile.c_str());
-    mLightMp = new LightMP(tInputfile);
+    const std::string tInputfileContents = Plato::PugiParser::readFile(tInputfile, mLocalComm);
+    mInputfileData = parser->parseString(tInputfileContents);
+    std::shared_ptr<pugi::xml_document> tInputTree = std::make_shared<pugi::xml_document>();
+    tInputTree->load_string(tInputfileContents.c_str());
+    mLightMp = new LightMP(tInputTree);
 
     if (parser)
     {
@@ -2441,7 +2652,7 @@ PlatoApp::PlatoApp(const std::string &aPhysics_XML_File, const std::string &aApp
 {
 
     const char* input_char = getenv("PLATO_APP_FILE");
-    Plato::Parser* parser = new Plato::PugiParser();
+    Plato::Parser* parser = new Plato::PugiParser(mLocalComm);
     mAppfileData = parser->parseFile(input_char);
 
     std::shared_ptr<pugi::xml_document> tTempDoc = std::make_shared<pugi::xml_document>();
@@ -65,6 +65,31 @@ class AbstractFilter;
 
 }
 
+#ifdef STK_ENABLED
+namespace stk
+{
+namespace mesh
+{
+class BulkData;
+class FieldBase;
+}
+}
+
+class Epetra_BlockMap;
+
+namespace Plato
+{
+
+// Sets the first value of aNodeField on every node from aValues, laid out by the
+// (overlapping) node map aMap.  Collective over the mesh's communicator.
+void copy_owned_node_values(stk::mesh::BulkData & aBulkData,
+                            const stk::mesh::FieldBase & aNodeField,
+                            const Epetra_BlockMap & aMap,
+                            const double* aValues);
+
+}
+#endif // STK_ENABLED
+
 /******************************************************************************/
 class PlatoApp : public Plato::Application
 /******************************************************************************/
@@ -324,10 +349,16 @@ private:
         void getArguments(std::vector<LocalArg> & aLocalArgs);
     private:
         void extract_iso_surface(int aIteration);
+        void write_restart_file(int aIteration);
+        void save_levelset_history(int aIteration);
         std::vector<LocalArg> m_outputData;
         int m_outputFrequency;
         int m_outputMethod;
         std::string mDiscretization;
+
+        // mesh used for restart output; read once, on the first restart write
+        struct RestartMesh;
+        std::shared_ptr<RestartMesh> mRestartMesh;
     };
     friend class PlatoMainOutput;
 
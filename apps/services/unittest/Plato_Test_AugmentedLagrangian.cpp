@@ -114,6 +114,37 @@ TEST(PlatoTest, CentralDifferenceHessian)
     PlatoTest::checkMultiVectorData(tOutput, tTrueHessianTimesVector);
 }
 
+TEST(PlatoTest, CriterionBatchedValuesAndGradients)
+{
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    Plato::Rosenbrock<double> tCriterion;
+
+    // ********* BATCH OF THREE CONTROLS *********
+    Plato::MultiVectorList<double> tControls;
+    tControls.add(Plato::StandardMultiVector<double>(tNumVectors, tNumControls));
+    tControls.add(Plato::StandardMultiVector<double>(tNumVectors, tNumControls));
+    tControls.add(Plato::StandardMultiVector<double>(tNumVectors, tNumControls));
+    tControls(0, 0).fill(2);
+    tControls(1, 0).fill(0.5);
+    tControls(2, 0)[0] = -1;
+    tControls(2, 0)[1] = 3;
+    Plato::MultiVectorList<double> tGradients(tControls.size(), tControls[0]);
+
+    // ********* THE DEFAULT BATCH EVALUATION MATCHES ONE-AT-A-TIME EVALUATIONS *********
+    std::vector<double> tValues;
+    tCriterion.values(tControls, tValues);
+    tCriterion.gradients(tControls, tGradients);
+    ASSERT_EQ(3u, tValues.size());
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    for(size_t tIndex = 0; tIndex < tControls.size(); tIndex++)
+    {
+        EXPECT_NEAR(tCriterion.value(tControls[tIndex]), tValues[tIndex], 1e-12);
+        tCriterion.gradient(tControls[tIndex], tGold);
+        PlatoTest::checkMultiVectorData(tGradients[tIndex], tGold);
+    }
+}
+
 TEST(PlatoTest, TrustRegionAlgorithmDataMng)
 {
     // ********* Test Factories for Dual Data *********
@@ -570,6 +601,38 @@ TEST(PlatoTest, RosenbrockCriterion)
     PlatoTest::checkMultiVectorData(tHessianTimesVector, tGoldVector);
 }
 
+TEST(PlatoTest, RosenbrockCriterionValueAndGradient)
+{
+    const double tValue = 2;
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    Plato::StandardMultiVector<double> tControl(tNumVectors, tNumControls, tValue);
+    std::shared_ptr<Plato::Rosenbrock<double>> tCriterion = std::make_shared<Plato::Rosenbrock<double>>();
+
+    // TEST FUSED OBJECTIVE AND GRADIENT EVALUATION
+    Plato::StandardMultiVector<double> tGradient(tNumVectors, tNumControls);
+    double tObjectiveValue = tCriterion->valueAndGradient(tControl, tGradient);
+    const double tGoldValue = 401;
+    const double tTolerance = 1e-6;
+    EXPECT_NEAR(tGoldValue, tObjectiveValue, tTolerance);
+    Plato::StandardMultiVector<double> tGoldVector(tNumVectors, tNumControls);
+    const size_t tVectorIndex = 0;
+    tGoldVector(tVectorIndex, 0) = 1602;
+    tGoldVector(tVectorIndex, 1) = -400;
+    PlatoTest::checkMultiVectorData(tGradient, tGoldVector);
+
+    // TEST FUSED EVALUATION THROUGH ANALYTICAL GRADIENT OPERATOR
+    Plato::fill(1., tGradient);
+    Plato::AnalyticalGradient<double> tGradientOperator(tCriterion);
+    tObjectiveValue = tGradientOperator.computeWithValue(*tCriterion, tControl, tGradient);
+    EXPECT_NEAR(tGoldValue, tObjectiveValue, tTolerance);
+    PlatoTest::checkMultiVectorData(tGradient, tGoldVector);
+
+    // ANALYTICAL CRITERIA DO NOT COMBINE THE VALUE AND GRADIENT EVALUATIONS
+    EXPECT_FALSE(tCriterion->hasFusedValueAndGradient());
+    EXPECT_FALSE(tGradientOperator.hasFusedValueAndGradient(*tCriterion));
+}
+
 TEST(PlatoTest, CircleCriterion)
 {
     const double tValue = 1;
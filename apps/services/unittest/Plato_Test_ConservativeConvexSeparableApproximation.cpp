@@ -48,8 +48,13 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <fstream>
+
 #include "Plato_UnitTestUtils.hpp"
 
+#include "Plato_Checkpoint.hpp"
+#include "Plato_Exceptions.hpp"
 #include "Plato_DataFactory.hpp"
 #include "Plato_LinearAlgebra.hpp"
 #include "Plato_CriterionList.hpp"
@@ -69,6 +74,63 @@
 namespace PlatoTest
 {
 
+/******************************************************************************//**
+ * @brief Solve the CCSA test problem with the Method of Moving Asymptotes
+ * @param [in] aMaxNumIterations maximum number of outer iterations
+ * @param [in] aCheckpointFileName checkpoint written every two iterations; empty for none
+ * @param [in] aRestartFileName checkpoint the solve restarts from; empty for none
+ * @param [out] aSolution final control
+ * @return number of outer iterations done
+**********************************************************************************/
+size_t solveCcsaTestProblem(const size_t & aMaxNumIterations,
+                            const std::string & aCheckpointFileName,
+                            const std::string & aRestartFileName,
+                            Plato::StandardMultiVector<double> & aSolution)
+{
+    std::shared_ptr<Plato::DataFactory<double>> tDataFactory = std::make_shared<Plato::DataFactory<double>>();
+    const size_t tNumDuals = 1;
+    const size_t tNumControls = 5;
+    tDataFactory->allocateDual(tNumDuals);
+    tDataFactory->allocateControl(tNumControls);
+
+    std::shared_ptr<Plato::ConservativeConvexSeparableAppxDataMng<double>> tDataMng =
+            std::make_shared<Plato::ConservativeConvexSeparableAppxDataMng<double>>(tDataFactory);
+    tDataMng->setInitialGuess(5);
+    tDataMng->setControlLowerBounds(1);
+    tDataMng->setControlUpperBounds(10);
+
+    std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+    tConstraintList->add(std::make_shared<Plato::CcsaTestInequality<double>>());
+    std::shared_ptr<Plato::CcsaTestObjective<double>> tObjective = std::make_shared<Plato::CcsaTestObjective<double>>();
+    std::shared_ptr<Plato::PrimalProblemStageMng<double>> tStageMng =
+            std::make_shared<Plato::PrimalProblemStageMng<double>>(tDataFactory, tObjective, tConstraintList);
+
+    std::shared_ptr<Plato::MethodMovingAsymptotes<double>> tSubProblem =
+            std::make_shared<Plato::MethodMovingAsymptotes<double>>(tDataFactory);
+    Plato::ConservativeConvexSeparableAppxAlgorithm<double> tAlgorithm(tStageMng, tDataMng, tSubProblem);
+    tAlgorithm.setMaxNumIterations(aMaxNumIterations);
+
+    if(aRestartFileName.empty() == false)
+    {
+        Plato::CheckpointReader tReader(aRestartFileName);
+        tAlgorithm.readCheckpoint(tReader);
+    }
+    if(aCheckpointFileName.empty() == false)
+    {
+        const size_t tCheckpointFrequency = 2;
+        tAlgorithm.setCheckpointFunction(tCheckpointFrequency, [&tAlgorithm, &aCheckpointFileName]()
+        {
+            Plato::CheckpointWriter tWriter(aCheckpointFileName);
+            tAlgorithm.writeCheckpoint(tWriter);
+            tWriter.close();
+        });
+    }
+    tAlgorithm.solve();
+
+    Plato::update(1., tDataMng->getCurrentControl(), 0., aSolution);
+    return (tAlgorithm.getNumIterationsDone());
+}
+
 TEST(PlatoTest, CcsaTestObjective)
 {
     // ********* Allocate Criterion *********
@@ -646,4 +708,60 @@ TEST(PlatoTest, TestStoppingCriterionOutputCCSA)
     ASSERT_STREQ(tDescription.c_str(), tGold.c_str());
 }
 
+TEST(PlatoTest, MethodMovingAsymptotesRestartFromCheckpoint)
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    const std::string tFileName = Plato::checkpoint_file_name("ccsa_restart_test", tMyRank);
+
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 5;
+    const std::string tNoFile;
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    const size_t tGoldNumIterations = PlatoTest::solveCcsaTestProblem(10, tNoFile, tNoFile, tGold);
+
+    // stop early, leaving a checkpoint of the last even iteration
+    Plato::StandardMultiVector<double> tSolution(tNumVectors, tNumControls);
+    EXPECT_EQ(4u, PlatoTest::solveCcsaTestProblem(4, tFileName, tNoFile, tSolution));
+
+    // the restarted solve continues from iteration four and reproduces the uninterrupted solve
+    EXPECT_EQ(tGoldNumIterations, PlatoTest::solveCcsaTestProblem(10, tNoFile, tFileName, tSolution));
+    PlatoTest::checkMultiVectorData(tSolution, tGold);
+
+    std::remove(tFileName.c_str());
+}
+
+TEST(PlatoTest, CheckpointReaderRejectsCorruptLengths)
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    const std::string tFileName = Plato::checkpoint_file_name("checkpoint_length_test", tMyRank);
+    {
+        Plato::CheckpointWriter tWriter(tFileName);
+        tWriter.write("x", std::vector<double>{1.0, 2.0});
+        tWriter.close();
+    }
+    Plato::CheckpointReader tGoodReader(tFileName);
+    EXPECT_EQ(2u, tGoodReader.size("x"));
+
+    // header is 8 magic bytes and a 4 byte version, then the record's name length, name and length
+    const std::streamoff tNameLengthOffset = 12;
+    const std::streamoff tLengthOffset = tNameLengthOffset + sizeof(uint32_t) + 1;
+    const uint32_t tHugeNameLength = 0xFFFFFFF0u;
+    const uint64_t tHugeLength = uint64_t(1) << 60;
+
+    std::fstream tFile(tFileName, std::ios::binary | std::ios::in | std::ios::out);
+    tFile.seekp(tLengthOffset);
+    tFile.write(reinterpret_cast<const char*>(&tHugeLength), sizeof(tHugeLength));
+    tFile.flush();
+    EXPECT_THROW(Plato::CheckpointReader tReader(tFileName), Plato::ParsingException);
+
+    tFile.seekp(tNameLengthOffset);
+    tFile.write(reinterpret_cast<const char*>(&tHugeNameLength), sizeof(tHugeNameLength));
+    tFile.close();
+    EXPECT_THROW(Plato::CheckpointReader tReader(tFileName), Plato::ParsingException);
+
+    std::remove(tFileName.c_str());
+}
+
 } // PlatoTest
@@ -0,0 +1,229 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Test_EvaluationCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "gtest/gtest.h"
+
+#include <mpi.h>
+
+#include "Plato_StandardVector.hpp"
+#include "Plato_EvaluationCache.hpp"
+
+namespace PlatoTest
+{
+
+TEST(PlatoTest, EvaluationCacheDisabled)
+{
+    Plato::EvaluationCache<double> tCache(0);
+    EXPECT_FALSE(tCache.isEnabled());
+
+    Plato::StandardVector<double> tControl(4, 0.5);
+    tCache.storeValue("Objective Value", tControl, 2.0);
+
+    double tValue = 0;
+    EXPECT_FALSE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControl, tValue));
+    EXPECT_EQ(0u, tCache.getNumHits());
+}
+
+TEST(PlatoTest, EvaluationCacheValueAndVector)
+{
+    Plato::EvaluationCache<double> tCache(2);
+    EXPECT_TRUE(tCache.isEnabled());
+
+    Plato::StandardVector<double> tControl(4, 0.5);
+    Plato::StandardVector<double> tGradient(4, 0.0);
+    tGradient[0] = 1.0; tGradient[1] = 2.0; tGradient[2] = 3.0; tGradient[3] = 4.0;
+    tCache.storeValue("Objective Value", tControl, 2.0);
+    tCache.storeVector("Objective Gradient", tControl, tGradient);
+
+    // same control, same stage: hit
+    double tValue = 0;
+    EXPECT_TRUE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControl, tValue));
+    EXPECT_DOUBLE_EQ(2.0, tValue);
+
+    Plato::StandardVector<double> tOutput(4, 0.0);
+    EXPECT_TRUE(tCache.findVector(MPI_COMM_WORLD, "Objective Gradient", tControl, tOutput));
+    for(size_t tIndex = 0; tIndex < tOutput.size(); tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(tGradient[tIndex], tOutput[tIndex]);
+    }
+
+    // different control: miss
+    Plato::StandardVector<double> tOtherControl(4, 0.5);
+    tOtherControl[2] = 0.25;
+    EXPECT_FALSE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tOtherControl, tValue));
+
+    // different stage: miss
+    EXPECT_FALSE(tCache.findValue(MPI_COMM_WORLD, "Constraint Value", tControl, tValue));
+
+    EXPECT_EQ(2u, tCache.getNumHits());
+    EXPECT_EQ(2u, tCache.getNumMisses());
+
+    tCache.clear();
+    EXPECT_FALSE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControl, tValue));
+}
+
+TEST(PlatoTest, EvaluationCacheEvictsLeastRecentlyUsed)
+{
+    Plato::EvaluationCache<double> tCache(2);
+
+    Plato::StandardVector<double> tControlOne(3, 1.0);
+    Plato::StandardVector<double> tControlTwo(3, 2.0);
+    Plato::StandardVector<double> tControlThree(3, 3.0);
+    tCache.storeValue("Objective Value", tControlOne, 1.0);
+    tCache.storeValue("Objective Value", tControlTwo, 2.0);
+
+    // touch the first entry so the second becomes the least recently used
+    double tValue = 0;
+    EXPECT_TRUE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControlOne, tValue));
+    tCache.storeValue("Objective Value", tControlThree, 3.0);
+
+    EXPECT_TRUE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControlOne, tValue));
+    EXPECT_DOUBLE_EQ(1.0, tValue);
+    EXPECT_FALSE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControlTwo, tValue));
+    EXPECT_TRUE(tCache.findValue(MPI_COMM_WORLD, "Objective Value", tControlThree, tValue));
+    EXPECT_DOUBLE_EQ(3.0, tValue);
+}
+
+/******************************************************************************//**
+ * @brief Performer that keeps the control of the last stage it ran, like an
+ * application that keeps the state solution for its gradient and cache stages
+ **********************************************************************************/
+struct StatefulPerformer
+{
+    StatefulPerformer(Plato::EvaluationCache<double> & aCache) :
+            mCache(aCache),
+            mNumStageComputes(0),
+            mState(3, 0.0)
+    {
+    }
+
+    double value(const Plato::StandardVector<double> & aControl)
+    {
+        double tValue = 0;
+        if(mCache.findValue(MPI_COMM_WORLD, "Objective Value", aControl, tValue, mNumStageComputes))
+        {
+            return (tValue);
+        }
+        this->solve(aControl);
+        tValue = aControl[0] + aControl[1] + aControl[2];
+        mCache.storeValue("Objective Value", aControl, tValue, mNumStageComputes);
+        return (tValue);
+    }
+
+    void gradient(const Plato::StandardVector<double> & aControl, Plato::StandardVector<double> & aOutput)
+    {
+        if(mCache.findVector(MPI_COMM_WORLD, "Objective Gradient", aControl, aOutput, mNumStageComputes))
+        {
+            return;
+        }
+        // the gradient stage reuses the state left by the last stage
+        mNumStageComputes++;
+        for(size_t tIndex = 0; tIndex < aOutput.size(); tIndex++)
+        {
+            aOutput[tIndex] = mState[tIndex];
+        }
+        mCache.storeVector("Objective Gradient", aControl, aOutput, mNumStageComputes);
+    }
+
+    void solve(const Plato::StandardVector<double> & aControl)
+    {
+        mNumStageComputes++;
+        mState.assign(aControl.data(), aControl.data() + aControl.size());
+    }
+
+    Plato::EvaluationCache<double> & mCache;
+    size_t mNumStageComputes;
+    std::vector<double> mState;
+};
+
+TEST(PlatoTest, EvaluationCacheStatefulRevisit)
+{
+    Plato::EvaluationCache<double> tCache(4, true);
+    EXPECT_TRUE(tCache.isStateful());
+    StatefulPerformer tPerformer(tCache);
+
+    Plato::StandardVector<double> tControlA(3, 1.0);
+    Plato::StandardVector<double> tControlB(3, 2.0);
+    EXPECT_DOUBLE_EQ(3.0, tPerformer.value(tControlA));
+    EXPECT_DOUBLE_EQ(6.0, tPerformer.value(tControlB));
+
+    // the performers hold B's state, so A is evaluated again rather than served from the cache
+    EXPECT_DOUBLE_EQ(3.0, tPerformer.value(tControlA));
+    EXPECT_EQ(3u, tPerformer.mNumStageComputes);
+    EXPECT_EQ(0u, tCache.getNumHits());
+
+    Plato::StandardVector<double> tGradient(3, 0.0);
+    tPerformer.gradient(tControlA, tGradient);
+    for(size_t tIndex = 0; tIndex < tGradient.size(); tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(tControlA[tIndex], tGradient[tIndex]);
+    }
+
+    // nothing ran since the gradient at A, so both outputs at A are current
+    EXPECT_DOUBLE_EQ(3.0, tPerformer.value(tControlA));
+    tPerformer.gradient(tControlA, tGradient);
+    EXPECT_EQ(4u, tPerformer.mNumStageComputes);
+    EXPECT_EQ(2u, tCache.getNumHits());
+}
+
+TEST(PlatoTest, EvaluationCacheStatelessRevisit)
+{
+    Plato::EvaluationCache<double> tCache(4);
+    EXPECT_FALSE(tCache.isStateful());
+    StatefulPerformer tPerformer(tCache);
+
+    Plato::StandardVector<double> tControlA(3, 1.0);
+    Plato::StandardVector<double> tControlB(3, 2.0);
+    EXPECT_DOUBLE_EQ(3.0, tPerformer.value(tControlA));
+    EXPECT_DOUBLE_EQ(6.0, tPerformer.value(tControlB));
+    EXPECT_DOUBLE_EQ(3.0, tPerformer.value(tControlA));
+    EXPECT_EQ(2u, tPerformer.mNumStageComputes);
+    EXPECT_EQ(1u, tCache.getNumHits());
+}
+
+} // namespace PlatoTest
@@ -404,6 +404,29 @@ TEST(PlatoTest, StageInputDataTest)
     EXPECT_FALSE(tOperationData.hasSubOperations());
 }
 
+TEST(PlatoTest, StageInputDataOptionsTest)
+{
+    Plato::StageInputDataMng tStageInputData;
+    std::string tStageName("Objective Gradient");
+    tStageInputData.add(tStageName);
+
+    // *********** TEST DEFAULTS ***********
+    EXPECT_FALSE(tStageInputData.getBatchTransmit(tStageName));
+    EXPECT_STREQ("LEVEL", tStageInputData.getExceptionCheck(tStageName).c_str());
+
+    // *********** SET OPTIONS AND TEST ***********
+    tStageInputData.setBatchTransmit(tStageName, true);
+    EXPECT_TRUE(tStageInputData.getBatchTransmit(tStageName));
+    tStageInputData.setExceptionCheck(tStageName, "STAGE");
+    EXPECT_STREQ("STAGE", tStageInputData.getExceptionCheck(tStageName).c_str());
+
+    // *********** OPTIONS DON'T LEAK INTO OTHER STAGES ***********
+    std::string tOtherStageName("Objective Value");
+    tStageInputData.add(tOtherStageName);
+    EXPECT_FALSE(tStageInputData.getBatchTransmit(tOtherStageName));
+    EXPECT_STREQ("LEVEL", tStageInputData.getExceptionCheck(tOtherStageName).c_str());
+}
+
 TEST(PlatoTest, OptimalityCriteriaEngineStageData)
 {
     Plato::OptimizerEngineStageData tOptimizerData;
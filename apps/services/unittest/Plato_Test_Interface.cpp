@@ -0,0 +1,318 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_Interface.hpp"
+#include "Plato_Checkpoint.hpp"
+#include "Plato_Exceptions.hpp"
+#include "Plato_Application.hpp"
+#include "Plato_DataFactory.hpp"
+#include "Plato_LinearAlgebra.hpp"
+#include "Plato_EngineObjective.hpp"
+#include "Plato_EngineConstraint.hpp"
+#include "Plato_StandardMultiVector.hpp"
+#include "Plato_OptimizerEngineStageData.hpp"
+
+#include <mpi.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <Teuchos_ParameterList.hpp>
+
+namespace Plato
+{
+namespace InterfaceTest
+{
+
+const std::string cInterfaceFileName = "interface_test.xml";
+
+/******************************************************************************//**
+ * @brief Application with one operation, Y = 2 X, on global values
+**********************************************************************************/
+class DoublingApplication : public Plato::Application
+{
+public:
+    DoublingApplication() :
+            mX(0),
+            mY(0)
+    {
+    }
+    void finalize()
+    {
+    }
+    void initialize()
+    {
+    }
+    void compute(const std::string & aOperationName)
+    {
+        if(aOperationName == "Double")
+        {
+            mY = 2.0 * mX;
+        }
+    }
+    void exportData(const std::string & aArgumentName, Plato::SharedData & aExportData)
+    {
+        std::vector<double> tData(1, mY);
+        aExportData.setData(tData);
+    }
+    void importData(const std::string & aArgumentName, const Plato::SharedData & aImportData)
+    {
+        std::vector<double> tData(1);
+        aImportData.getData(tData);
+        mX = tData[0];
+    }
+    void exportDataMap(const Plato::data::layout_t & aDataLayout, std::vector<int> & aMyOwnedGlobalIDs)
+    {
+    }
+
+private:
+    double mX;
+    double mY;
+};
+
+/******************************************************************************//**
+ * @brief Every rank is the PlatoMain performer; stage 'Double' runs Y = 2 X
+**********************************************************************************/
+void writeInterfaceFile()
+{
+    int tRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    if(tRank == 0)
+    {
+        // X carries the <Type> tag older interface definitions still have
+        std::ofstream tFile(cInterfaceFileName);
+        tFile << "<Performer><Name>PlatoMain</Name><Code>Plato_Main</Code><PerformerID>0</PerformerID></Performer>\n"
+              << "<SharedData><Name>X</Name><Type>Scalar</Type><Layout>Global</Layout><Size>1</Size>"
+              << "<OwnerName>PlatoMain</OwnerName><UserName>PlatoMain</UserName></SharedData>\n"
+              << "<SharedData><Name>Y</Name><Layout>Global</Layout><Size>1</Size>"
+              << "<OwnerName>PlatoMain</OwnerName><UserName>PlatoMain</UserName></SharedData>\n"
+              << "<Stage><Name>Double</Name><Input><SharedDataName>X</SharedDataName></Input>"
+              << "<Operation><Name>Double</Name><PerformerName>PlatoMain</PerformerName>"
+              << "<Input><ArgumentName>X</ArgumentName><SharedDataName>X</SharedDataName></Input>"
+              << "<Output><ArgumentName>Y</ArgumentName><SharedDataName>Y</SharedDataName></Output></Operation>"
+              << "<Output><SharedDataName>Y</SharedDataName></Output></Stage>\n";
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    setenv("PLATO_INTERFACE_FILE", cInterfaceFileName.c_str(), 1);
+    setenv("PLATO_PERFORMER_ID", "0", 1);
+}
+
+void removeInterfaceFile()
+{
+    MPI_Barrier(MPI_COMM_WORLD);
+    int tRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    if(tRank == 0)
+    {
+        std::remove(cInterfaceFileName.c_str());
+    }
+}
+
+/******************************************************************************//**
+ * @brief Optimizer input that evaluates the objective and constraint with stage aStageName
+**********************************************************************************/
+Plato::OptimizerEngineStageData makeInputData(const std::string & aStageName)
+{
+    Plato::OptimizerEngineStageData tInputData;
+    tInputData.addControlName("X");
+    tInputData.setObjectiveValueOutputName("Y");
+    tInputData.setObjectiveValueStageName(aStageName);
+    tInputData.addConstraintValueName("Y");
+    tInputData.setConstraintValueStageNames({aStageName});
+    tInputData.setConstraintGradientStageNames({aStageName});
+    tInputData.addConstraintReferenceValue("Y", 1.0);
+    tInputData.addConstraintNormalizedTargetValue("Y", 0.0);
+    return tInputData;
+}
+
+TEST(PlatoInterface, computeByHandle)
+{
+    writeInterfaceFile();
+    Plato::Interface tInterface;
+    DoublingApplication tApplication;
+    tInterface.registerApplication(&tApplication);
+
+    const int tStage = tInterface.bindStage("Double");
+    EXPECT_EQ(tInterface.getStageIndex("Double"), tStage);
+    EXPECT_THROW(tInterface.bindStage("Missing"), Plato::ParsingException);
+
+    double tX = 3.0;
+    double tY = 0.0;
+    Teuchos::ParameterList tArguments;
+    tArguments.set("X", &tX);
+    tArguments.set("Y", &tY);
+    tInterface.compute(tStage, tArguments);
+    EXPECT_DOUBLE_EQ(6.0, tY);
+
+    // the handle refers to the same shared data the stage wrote
+    double tOutput = 0.0;
+    tInterface.importData(&tOutput, tInterface.bindSharedData("Y"));
+    EXPECT_DOUBLE_EQ(6.0, tOutput);
+
+    removeInterfaceFile();
+}
+
+TEST(PlatoInterface, computeInvalidHandleThrows)
+{
+    writeInterfaceFile();
+    Plato::Interface tInterface;
+    DoublingApplication tApplication;
+    tInterface.registerApplication(&tApplication);
+
+    Teuchos::ParameterList tArguments;
+    const int tNumStages = 1;
+    EXPECT_ANY_THROW(tInterface.compute(tNumStages, tArguments));
+
+    removeInterfaceFile();
+}
+
+TEST(PlatoInterface, engineCriteriaComputeByHandle)
+{
+    writeInterfaceFile();
+    Plato::Interface tInterface;
+    DoublingApplication tApplication;
+    tInterface.registerApplication(&tApplication);
+
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(1);
+    Plato::StandardMultiVector<double> tControl(1, 1, 3.0);
+
+    const Plato::OptimizerEngineStageData tInputData = makeInputData("Double");
+    Plato::EngineObjective<double> tObjective(tDataFactory, tInputData, &tInterface);
+    Plato::EngineConstraint<double> tConstraint(0, tDataFactory, tInputData, &tInterface);
+
+    EXPECT_DOUBLE_EQ(6.0, tObjective.value(tControl));
+    tControl(0, 0) = 4.0;
+    EXPECT_DOUBLE_EQ(8.0, tConstraint.value(tControl));
+    EXPECT_EQ(2u, tInterface.getNumStageComputes());
+
+    removeInterfaceFile();
+}
+
+TEST(PlatoInterface, engineCriteriaUnknownStageThrows)
+{
+    writeInterfaceFile();
+    Plato::Interface tInterface;
+    DoublingApplication tApplication;
+    tInterface.registerApplication(&tApplication);
+
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(1);
+    Plato::StandardMultiVector<double> tControl(1, 1, 3.0);
+
+    // the unknown name is reported by the next stage on every rank, not by the constructor
+    const Plato::OptimizerEngineStageData tInputData = makeInputData("Missing");
+    Plato::EngineObjective<double> tObjective(tDataFactory, tInputData, &tInterface);
+    EXPECT_ANY_THROW(tObjective.value(tControl));
+
+    removeInterfaceFile();
+}
+
+TEST(PlatoInterface, restartFromNewestCompleteCheckpoint)
+{
+    writeInterfaceFile();
+    Plato::Interface tInterface;
+    DoublingApplication tApplication;
+    tInterface.registerApplication(&tApplication);
+
+    int tRank = 0;
+    int tNumRanks = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    const std::string tBaseName = tInterface.getCheckpointFileName();
+
+    // checkpoint 1 goes to slot 1 and checkpoint 2 to slot 0
+    const int tX = tInterface.bindSharedData("X");
+    double tValue = 3.0;
+    tInterface.exportData(&tValue, tX);
+    tInterface.writeCheckpoint();
+    tValue = 5.0;
+    tInterface.exportData(&tValue, tX);
+    tInterface.writeCheckpoint();
+    EXPECT_EQ(2, tInterface.getCheckpointTag());
+
+    // both slots are complete, so the newest is read
+    tValue = 7.0;
+    tInterface.exportData(&tValue, tX);
+    tInterface.readCheckpoint();
+    tInterface.importData(&tValue, tX);
+    EXPECT_DOUBLE_EQ(5.0, tValue);
+    EXPECT_EQ(2, tInterface.getCheckpointTag());
+
+    // the optimizer only has checkpoint 1, so both are restored from slot 1
+    int tOptimizerSlot = -1;
+    tInterface.readCheckpoint({-1, 1}, [&tOptimizerSlot](int aSlot) { tOptimizerSlot = aSlot; });
+    tInterface.importData(&tValue, tX);
+    EXPECT_DOUBLE_EQ(3.0, tValue);
+    EXPECT_EQ(1, tOptimizerSlot);
+    EXPECT_EQ(1, tInterface.getCheckpointTag());
+
+    // checkpoint 2 is missing on the last rank only, as after a crash while writing it
+    if(tRank == tNumRanks - 1)
+    {
+        std::remove(Plato::checkpoint_file_name(tBaseName, 0, tRank).c_str());
+    }
+    tValue = 7.0;
+    tInterface.exportData(&tValue, tX);
+    tInterface.readCheckpoint();
+    tInterface.importData(&tValue, tX);
+    EXPECT_DOUBLE_EQ(3.0, tValue);
+
+    // with neither slot complete the restart fails on every rank
+    if(tRank == tNumRanks - 1)
+    {
+        std::remove(Plato::checkpoint_file_name(tBaseName, 1, tRank).c_str());
+    }
+    EXPECT_ANY_THROW(tInterface.readCheckpoint());
+
+    for(int tSlot = 0; tSlot < Plato::cNumCheckpointSlots; tSlot++)
+    {
+        std::remove(Plato::checkpoint_file_name(tBaseName, tSlot, tRank).c_str());
+    }
+    removeInterfaceFile();
+}
+
+} // namespace InterfaceTest
+} // namespace Plato
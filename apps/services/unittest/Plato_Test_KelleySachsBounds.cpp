@@ -48,8 +48,11 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+
 #include "Plato_UnitTestUtils.hpp"
 
+#include "Plato_Checkpoint.hpp"
 #include "Plato_KelleySachsBoundLightInterface.hpp"
 
 #include "Plato_Circle.hpp"
@@ -66,6 +69,59 @@
 namespace PlatoTest
 {
 
+/******************************************************************************//**
+ * @brief Solve the bound constrained Rosenbrock problem with Kelley-Sachs
+ * @param [in] aMaxNumIterations maximum number of outer iterations
+ * @param [in] aCheckpointFileName checkpoint written every two iterations; empty for none
+ * @param [in] aRestartFileName checkpoint the solve restarts from; empty for none
+ * @param [out] aSolution final control
+ * @return number of outer iterations done
+**********************************************************************************/
+size_t solveKsbcRosenbrock(const size_t & aMaxNumIterations,
+                           const std::string & aCheckpointFileName,
+                           const std::string & aRestartFileName,
+                           Plato::StandardMultiVector<double> & aSolution)
+{
+    std::shared_ptr<Plato::CriterionList<double>> tObjective = std::make_shared<Plato::CriterionList<double>>();
+    tObjective->add(std::make_shared<Plato::Rosenbrock<double>>());
+
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    std::shared_ptr<Plato::DataFactory<double>> tDataFactory = std::make_shared<Plato::DataFactory<double>>();
+    tDataFactory->allocateControl(tNumControls, tNumVectors);
+
+    std::shared_ptr<Plato::TrustRegionAlgorithmDataMng<double>> tDataMng =
+            std::make_shared<Plato::TrustRegionAlgorithmDataMng<double>>(tDataFactory);
+    tDataMng->setInitialGuess(2);
+    tDataMng->setControlLowerBounds(-10);
+    tDataMng->setControlUpperBounds(10);
+
+    std::shared_ptr<Plato::ReducedSpaceTrustRegionStageMng<double>> tStageMng =
+            std::make_shared<Plato::ReducedSpaceTrustRegionStageMng<double>>(tDataFactory, tObjective);
+    Plato::KelleySachsBoundConstrained<double> tAlgorithm(tDataFactory, tDataMng, tStageMng);
+    tAlgorithm.setMaxNumIterations(aMaxNumIterations);
+
+    if(aRestartFileName.empty() == false)
+    {
+        Plato::CheckpointReader tReader(aRestartFileName);
+        tAlgorithm.readCheckpoint(tReader);
+    }
+    if(aCheckpointFileName.empty() == false)
+    {
+        const size_t tCheckpointFrequency = 2;
+        tAlgorithm.setCheckpointFunction(tCheckpointFrequency, [&tAlgorithm, &aCheckpointFileName]()
+        {
+            Plato::CheckpointWriter tWriter(aCheckpointFileName);
+            tAlgorithm.writeCheckpoint(tWriter);
+            tWriter.close();
+        });
+    }
+    tAlgorithm.solve();
+
+    Plato::update(1., tDataMng->getCurrentControl(), 0., aSolution);
+    return (tAlgorithm.getNumIterationsDone());
+}
+
 TEST(PlatoTest, ReducedSpaceTrustRegionStageMngTestOne)
 {
     // ************** ALLOCATE SIMPLE STRUCTURAL TOPOLOGY OPTIMIZATION SOLVER **************
@@ -365,6 +421,27 @@ TEST(PlatoTest, KelleySachsBoundConstrainedRosenbrock)
     EXPECT_NEAR(1.0, (*tOutputs.mSolution)(0,1), tTolerance);
 }
 
+TEST(PlatoTest, KelleySachsBoundConstrainedRestart)
+{
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    const std::string tNoFile;
+    const std::string tFileName("ksbc_restart_test.bin");
+
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    const size_t tGoldNumIterations = PlatoTest::solveKsbcRosenbrock(50, tNoFile, tNoFile, tGold);
+
+    // stop early, leaving a checkpoint of the last even iteration
+    Plato::StandardMultiVector<double> tSolution(tNumVectors, tNumControls);
+    EXPECT_EQ(4u, PlatoTest::solveKsbcRosenbrock(4, tFileName, tNoFile, tSolution));
+
+    // the restarted solve continues from iteration four with the checkpointed trust region radius
+    EXPECT_EQ(tGoldNumIterations, PlatoTest::solveKsbcRosenbrock(50, tNoFile, tFileName, tSolution));
+    PlatoTest::checkMultiVectorData(tSolution, tGold);
+
+    std::remove(tFileName.c_str());
+}
+
 TEST(PlatoTest, KelleySachsBoundConstrainedCircle)
 {
     // ********* ALLOCATE OBJECTIVE AND CONSTRAINT CRITERIA *********
@@ -52,6 +52,7 @@
 
 #include "Plato_KokkosVector.hpp"
 #include "Plato_KokkosReductionOperations.hpp"
+#include "Plato_FieldAggregation.hpp"
 #include "Plato_DeviceOptimalityCriteriaUpdate.hpp"
 
 namespace PlatoTest
@@ -230,4 +231,36 @@ TEST(PlatoTest, KokkosNonlinearProgrammingUpdate)
     PlatoTest::checkVectorData(tControl, tControlGold);
 }
 
+TEST(PlatoTest, AggregateFields)
+{
+    // span several blocks, with a partial last block
+    const int tLength = 2500;
+    std::vector<double> tFieldOne(tLength), tFieldTwo(tLength), tFieldThree(tLength);
+    for(int tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        tFieldOne[tIndex] = tIndex;
+        tFieldTwo[tIndex] = 2.0 * tIndex + 1.0;
+        tFieldThree[tIndex] = -1.0;
+    }
+    std::vector<const double*> tInputs = {tFieldOne.data(), tFieldTwo.data(), tFieldThree.data()};
+    std::vector<double> tWeights = {0.5, 0.25, 2.0};
+
+    std::vector<double> tOutput(tLength, 99.0);
+    Plato::aggregate(tInputs, tWeights, tLength, tOutput.data());
+
+    const double tTolerance = 1e-12;
+    for(int tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        const double tGold = 0.5 * tFieldOne[tIndex] + 0.25 * tFieldTwo[tIndex] + 2.0 * tFieldThree[tIndex];
+        EXPECT_NEAR(tGold, tOutput[tIndex], tTolerance);
+    }
+
+    // no inputs gives a zero field
+    Plato::aggregate(std::vector<const double*>(), tWeights, tLength, tOutput.data());
+    for(int tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        EXPECT_EQ(0.0, tOutput[tIndex]);
+    }
+}
+
 } // namespace PlatoTest
@@ -249,6 +249,77 @@ void setSynthesisOptimizationTestGold(std::vector<double> & aControl, std::vecto
         0.1890881072835, 0.108099284394354, 0.0806440730635803};
 }
 
+//! Criterion that records the order in which the stage manager calls it
+class CallRecorderCriterion : public Plato::Criterion<double>
+{
+public:
+    CallRecorderCriterion(const std::string & aName, std::vector<std::string> & aCalls, bool aFused = false) :
+            mName(aName),
+            mCalls(aCalls),
+            mFused(aFused)
+    {
+    }
+    void cacheData()
+    {
+        mCalls.push_back(mName + " cacheData");
+    }
+    double value(const Plato::MultiVector<double> & aControl)
+    {
+        mCalls.push_back(mName + " value");
+        return (0);
+    }
+    void gradient(const Plato::MultiVector<double> & aControl, Plato::MultiVector<double> & aOutput)
+    {
+        mCalls.push_back(mName + " gradient");
+    }
+    double valueAndGradient(const Plato::MultiVector<double> & aControl, Plato::MultiVector<double> & aOutput)
+    {
+        if(mFused == false)
+        {
+            return (Plato::Criterion<double>::valueAndGradient(aControl, aOutput));
+        }
+        mCalls.push_back(mName + " valueAndGradient");
+        return (0);
+    }
+    bool hasFusedValueAndGradient() const
+    {
+        return (mFused);
+    }
+    void hessian(const Plato::MultiVector<double> & aControl,
+                 const Plato::MultiVector<double> & aVector,
+                 Plato::MultiVector<double> & aOutput)
+    {
+    }
+
+private:
+    std::string mName;
+    std::vector<std::string> & mCalls;
+    bool mFused;
+};
+
+std::vector<std::string> recordOptimalityCriteriaUpdate(bool aFusedObjective)
+{
+    std::shared_ptr<Plato::DataFactory<double>> tFactory = std::make_shared<Plato::DataFactory<double>>();
+    const size_t tNumVectors = 1;
+    const size_t tNumDual = 1;
+    tFactory->allocateDual(tNumDual, tNumVectors);
+    const size_t tNumStates = 1;
+    tFactory->allocateState(tNumStates, tNumVectors);
+    const size_t tNumControls = 3;
+    tFactory->allocateControl(tNumControls, tNumVectors);
+
+    std::vector<std::string> tCalls;
+    std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+    tConstraintList->add(std::make_shared<PlatoTest::CallRecorderCriterion>("constraint", tCalls));
+    std::shared_ptr<PlatoTest::CallRecorderCriterion> tObjective =
+            std::make_shared<PlatoTest::CallRecorderCriterion>("objective", tCalls, aFusedObjective);
+    Plato::OptimalityCriteriaStageMng<double> tStageMng(tFactory, tObjective, tConstraintList);
+
+    Plato::OptimalityCriteriaDataMng<double> tDataMng(tFactory);
+    tStageMng.update(tDataMng);
+    return (tCalls);
+}
+
 void setSynthesisOptimizationTestData(Plato::OptimalityCriteriaDataMng<double> & aDataMng)
 {
     size_t tOrdinalValue = 0;
@@ -1176,6 +1247,22 @@ TEST(PlatoTest, OptimalityCriteriaStageMngSimpleTest)
     PlatoTest::checkVectorData(tDataMng.getInequalityGradient(tVectorIndex), tGoldInequalityGradient);
 }
 
+TEST(PlatoTest, OptimalityCriteriaStageMngUpdateOrder)
+{
+    // objective gradient is computed after the criteria data are cached
+    std::vector<std::string> tCalls = PlatoTest::recordOptimalityCriteriaUpdate(false);
+    std::vector<std::string> tGold =
+        { "objective value", "constraint value", "objective cacheData", "constraint cacheData", "objective gradient",
+          "constraint gradient" };
+    EXPECT_EQ(tGold, tCalls);
+
+    // objective with a combined value and gradient evaluation
+    tCalls = PlatoTest::recordOptimalityCriteriaUpdate(true);
+    tGold = { "objective valueAndGradient", "constraint value", "objective cacheData", "constraint cacheData",
+              "constraint gradient" };
+    EXPECT_EQ(tGold, tCalls);
+}
+
 TEST(PlatoTest, SynthesisOptimizationSubProblemOne)
 {
     // ********* Allocate Core Optimization Data Templates *********
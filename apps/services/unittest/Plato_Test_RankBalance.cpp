@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_RankBalance.hpp"
+
+#include <mpi.h>
+#include <map>
+#include <string>
+
+namespace Plato
+{
+namespace RankBalanceTest
+{
+
+TEST(PlatoRankBalance, recommendSplitProportionalToWork)
+{
+    std::map<int, double> tWork = { {0, 1.0}, {1, 9.0} };
+    std::map<int, int> tNumComms = { {0, 1}, {1, 1} };
+    std::map<int, int> tSplit = Plato::RankBalance::recommendSplit(tWork, tNumComms, 10);
+    EXPECT_EQ(1, tSplit[0]);
+    EXPECT_EQ(9, tSplit[1]);
+}
+
+TEST(PlatoRankBalance, recommendSplitKeepsOneRankAndCommMultiples)
+{
+    // performer 0 is nearly idle but keeps one rank; performer 2 splits its ranks into two comms
+    std::map<int, double> tWork = { {0, 0.01}, {1, 4.0}, {2, 6.0} };
+    std::map<int, int> tNumComms = { {0, 1}, {1, 1}, {2, 2} };
+    std::map<int, int> tSplit = Plato::RankBalance::recommendSplit(tWork, tNumComms, 11);
+    EXPECT_EQ(1, tSplit[0]);
+    EXPECT_EQ(0, tSplit[2] % 2);
+    EXPECT_EQ(11, tSplit[0] + tSplit[1] + tSplit[2]);
+    EXPECT_EQ(4, tSplit[1]);
+    EXPECT_EQ(6, tSplit[2]);
+}
+
+TEST(PlatoRankBalance, reportAfterIterations)
+{
+    int tRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+
+    Plato::RankBalance tBalance;
+    EXPECT_FALSE(tBalance.isEnabled());
+    tBalance.enable(MPI_COMM_WORLD, /*performer id=*/0, /*comms=*/1, /*iterations=*/2, "Objective", "");
+    EXPECT_TRUE(tBalance.isEnabled());
+
+    for(int tIteration = 0; tIteration < 2; tIteration++)
+    {
+        tBalance.beginStage();
+        tBalance.beginBusy();
+        tBalance.endBusy();
+        tBalance.endStage("Cache State");
+        EXPECT_TRUE(tBalance.isEnabled());
+
+        tBalance.beginStage();
+        tBalance.endStage("Objective");
+    }
+
+    // the report is written once, on rank 0, and the measurement stops
+    EXPECT_FALSE(tBalance.isEnabled());
+    if(tRank == 0)
+    {
+        EXPECT_NE(std::string::npos, tBalance.getReport().find("after 2 iterations"));
+        EXPECT_NE(std::string::npos, tBalance.getReport().find("PLATO_PERFORMER_ID=0"));
+    }
+    else
+    {
+        EXPECT_TRUE(tBalance.getReport().empty());
+    }
+}
+
+} // namespace RankBalanceTest
+} // namespace Plato
@@ -0,0 +1,116 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Test_RestartField.cpp
+ *
+ */
+
+#ifdef STK_ENABLED
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <mpi.h>
+
+#include "Epetra_MpiComm.h"
+#include "Epetra_Map.h"
+
+#include <stk_io/StkMeshIoBroker.hpp>
+#include <stk_mesh/base/Field.hpp>
+#include <stk_mesh/base/GetEntities.hpp>
+
+#include "PlatoApp.hpp"
+#include "Plato_StkMeshUtils.hpp"
+
+namespace Plato
+{
+namespace RestartFieldTest
+{
+
+double nodeValue(int aGlobalID)
+{
+    return 1.0 + 0.5 * aGlobalID;
+}
+
+// Run on two ranks: the split mesh has shared nodes, which appear in both ranks'
+// overlapping maps and must not be counted twice.
+TEST(PlatoRestartField, restartFieldMatchesOverlappingValues)
+{
+    stk::io::StkMeshIoBroker tBroker(MPI_COMM_WORLD);
+    tBroker.add_mesh_database("generated:2x2x4", "generated", stk::io::READ_MESH);
+    tBroker.create_input_mesh();
+    stk::mesh::MetaData & tMetaData = tBroker.meta_data();
+    stk::mesh::Field<double> & tDofs = tMetaData.declare_field<stk::mesh::Field<double>>(stk::topology::NODE_RANK, "optimizationdofs", 1);
+    stk::mesh::put_field(tDofs, tMetaData.universal_part());
+    tBroker.populate_bulk_data();
+    stk::mesh::BulkData & tBulkData = tBroker.bulk_data();
+
+    // the in-memory field: owned and shared nodes, as the plot file decomposition has them
+    std::vector<int> tGlobalIDs;
+    Plato::buildCommunicationOwnedAndSharedNodeMap(tBulkData, tMetaData, tGlobalIDs);
+    Epetra_MpiComm tComm(MPI_COMM_WORLD);
+    Epetra_Map tMap(-1, tGlobalIDs.size(), tGlobalIDs.data(), 0, tComm);
+    std::vector<double> tValues(tGlobalIDs.size());
+    for(size_t tIndex = 0; tIndex < tGlobalIDs.size(); tIndex++)
+    {
+        tValues[tIndex] = nodeValue(tGlobalIDs[tIndex]);
+    }
+
+    Plato::copy_owned_node_values(tBulkData, tDofs, tMap, tValues.data());
+
+    std::vector<stk::mesh::Entity> tNodes;
+    stk::mesh::get_selected_entities(tMetaData.locally_owned_part() | tMetaData.globally_shared_part(),
+                                     tBulkData.buckets(stk::topology::NODE_RANK), tNodes);
+    ASSERT_FALSE(tNodes.empty());
+    for(const stk::mesh::Entity & tNode : tNodes)
+    {
+        const int tGlobalID = tBulkData.identifier(tNode);
+        EXPECT_DOUBLE_EQ(nodeValue(tGlobalID), stk::mesh::field_data(tDofs, tNode)[0]) << "node " << tGlobalID;
+    }
+}
+
+} // namespace RestartFieldTest
+} // namespace Plato
+
+#endif // STK_ENABLED
@@ -0,0 +1,319 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_SharedField.hpp"
+#include "Plato_Communication.hpp"
+#include "Plato_SharedDataBatch.hpp"
+#include "Plato_SharedIntegerField.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace Plato
+{
+namespace SharedFieldTest
+{
+
+const int cNumGlobalIDs = 10;
+
+/******************************************************************************//**
+ * @brief Rank 0 provides every global id and the other ranks receive all of them;
+ * a single rank provides and receives.
+**********************************************************************************/
+std::shared_ptr<Plato::SharedField> makeField(const std::string & aName,
+                                              Plato::CommunicationData & aCommData,
+                                              int aNumComponents = 1)
+{
+    int tRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+
+    aCommData.mLocalComm = MPI_COMM_WORLD;
+    aCommData.mInterComm = MPI_COMM_WORLD;
+    std::vector<int> & tOwnedGlobalIDs = aCommData.mMyOwnedGlobalIDs[Plato::data::layout_t::SCALAR_FIELD];
+    tOwnedGlobalIDs.clear();
+    for(int tGlobalID = 0; tGlobalID < cNumGlobalIDs; tGlobalID++)
+    {
+        tOwnedGlobalIDs.push_back(tGlobalID);
+    }
+
+    Plato::communication::broadcast_t tBroadcast = Plato::communication::broadcast_t::SENDER_AND_RECEIVER;
+    if(tNumRanks > 1)
+    {
+        tBroadcast = tRank == 0 ? Plato::communication::broadcast_t::SENDER : Plato::communication::broadcast_t::RECEIVER;
+    }
+    return std::make_shared<Plato::SharedField>(aName, tBroadcast, aCommData, Plato::data::layout_t::SCALAR_FIELD, aNumComponents);
+}
+
+std::vector<double> makeValues(int aLength, double aOffset)
+{
+    std::vector<double> tValues(aLength);
+    for(int tIndex = 0; tIndex < aLength; tIndex++)
+    {
+        tValues[tIndex] = aOffset + tIndex;
+    }
+    return tValues;
+}
+
+void setValues(Plato::SharedField & aField, double aOffset)
+{
+    if(aField.myBroadcast() != Plato::communication::broadcast_t::RECEIVER)
+    {
+        aField.setData(makeValues(cNumGlobalIDs * aField.numComponents(), aOffset));
+    }
+}
+
+void checkValues(const Plato::SharedField & aField, double aOffset)
+{
+    if(aField.myBroadcast() != Plato::communication::broadcast_t::SENDER)
+    {
+        std::vector<double> tValues(cNumGlobalIDs * aField.numComponents(), -1.0);
+        aField.getData(tValues);
+        EXPECT_EQ(makeValues(cNumGlobalIDs * aField.numComponents(), aOffset), tValues);
+    }
+}
+
+TEST(PlatoSharedField, multiComponentTransmit)
+{
+    Plato::CommunicationData tCommData;
+    std::shared_ptr<Plato::SharedField> tField = makeField("Displacement", tCommData, 3);
+    EXPECT_EQ(3, tField->numComponents());
+    EXPECT_EQ(3 * cNumGlobalIDs, tField->size());
+
+    // blocking and nonblocking transmits move whole, interleaved entries
+    setValues(*tField, 1.0);
+    tField->transmitData();
+    checkValues(*tField, 1.0);
+    tField->setNonblockingTransmit(true);
+    setValues(*tField, 50.0);
+    tField->transmitData();
+    checkValues(*tField, 50.0);
+    tField->setNonblockingTransmit(false);
+
+    // single values address a component of a global id
+    const int tGlobalID = 4;
+    if(tField->myBroadcast() != Plato::communication::broadcast_t::RECEIVER)
+    {
+        tField->setData(-7.0, tGlobalID, 2);
+    }
+    tField->transmitData();
+    if(tField->myBroadcast() != Plato::communication::broadcast_t::SENDER)
+    {
+        for(int tComponent = 0; tComponent < 3; tComponent++)
+        {
+            double tValue = 0.0;
+            tField->getData(tValue, tGlobalID, tComponent);
+            EXPECT_EQ(tComponent == 2 ? -7.0 : 50.0 + 3 * tGlobalID + tComponent, tValue);
+        }
+    }
+}
+
+TEST(PlatoSharedIntegerField, transmit)
+{
+    int tRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+
+    Plato::CommunicationData tCommData;
+    tCommData.mLocalComm = MPI_COMM_WORLD;
+    tCommData.mInterComm = MPI_COMM_WORLD;
+    std::vector<int> & tOwnedGlobalIDs = tCommData.mMyOwnedGlobalIDs[Plato::data::layout_t::ELEMENT_FIELD];
+    for(int tGlobalID = 0; tGlobalID < cNumGlobalIDs; tGlobalID++)
+    {
+        tOwnedGlobalIDs.push_back(tGlobalID);
+    }
+    Plato::communication::broadcast_t tBroadcast = Plato::communication::broadcast_t::SENDER_AND_RECEIVER;
+    if(tNumRanks > 1)
+    {
+        tBroadcast = tRank == 0 ? Plato::communication::broadcast_t::SENDER : Plato::communication::broadcast_t::RECEIVER;
+    }
+    Plato::SharedIntegerField tField("Block IDs", tBroadcast, tCommData, Plato::data::layout_t::ELEMENT_FIELD, 2);
+    EXPECT_EQ(2 * cNumGlobalIDs, tField.size());
+
+    // integer values move without a round trip through doubles
+    std::vector<int> tProvided(2 * cNumGlobalIDs);
+    for(int tIndex = 0; tIndex < 2 * cNumGlobalIDs; tIndex++)
+    {
+        tProvided[tIndex] = 16777217 + tIndex;
+    }
+    if(tBroadcast != Plato::communication::broadcast_t::RECEIVER)
+    {
+        tField.setIntegerData(tProvided);
+    }
+    tField.transmitData();
+    if(tBroadcast != Plato::communication::broadcast_t::SENDER)
+    {
+        std::vector<int> tReceived(2 * cNumGlobalIDs, -1);
+        tField.getIntegerData(tReceived);
+        EXPECT_EQ(tProvided, tReceived);
+    }
+
+    // the double interface converts
+    if(tBroadcast != Plato::communication::broadcast_t::RECEIVER)
+    {
+        tField.setData(makeValues(2 * cNumGlobalIDs, 3.0));
+    }
+    tField.transmitData();
+    if(tBroadcast != Plato::communication::broadcast_t::SENDER)
+    {
+        std::vector<double> tReceived(2 * cNumGlobalIDs, -1.0);
+        tField.getData(tReceived);
+        EXPECT_EQ(makeValues(2 * cNumGlobalIDs, 3.0), tReceived);
+    }
+}
+
+TEST(PlatoSharedField, sharedMemoryTransmit)
+{
+    Plato::CommunicationData tCommData;
+    std::shared_ptr<Plato::SharedField> tField = makeField("Topology", tCommData);
+
+    // values provided before switching to shared memory are kept
+    setValues(*tField, 1.0);
+    tField->setSharedMemoryTransmit(true);
+    EXPECT_TRUE(tField->isSharedMemoryTransmit());
+    EXPECT_FALSE(tField->isNonblockingTransmit());
+    tField->transmitData();
+    checkValues(*tField, 1.0);
+
+    // the provider may overwrite its field as soon as the transmit returns
+    setValues(*tField, 20.0);
+    checkValues(*tField, 1.0);
+    tField->transmitData();
+    checkValues(*tField, 20.0);
+
+    // the provided values move back out of the window
+    tField->setSharedMemoryTransmit(false);
+    EXPECT_FALSE(tField->isSharedMemoryTransmit());
+    tField->transmitData();
+    checkValues(*tField, 20.0);
+}
+
+TEST(PlatoSharedField, batchedTransmit)
+{
+    Plato::CommunicationData tCommData;
+    std::vector<std::shared_ptr<Plato::SharedField>> tFields;
+    std::vector<Plato::SharedData*> tSharedData;
+    for(const char* tName : {"Displacement", "Velocity", "Acceleration"})
+    {
+        tFields.push_back(makeField(tName, tCommData, 2));
+        tFields.back()->setCommunicationPattern("pattern");
+        tSharedData.push_back(tFields.back().get());
+    }
+    Plato::SharedDataBatch tBatch(tSharedData);
+    EXPECT_EQ(0, tBatch.getNumUnbatched());
+
+    // each field keeps its own values through the shared plan, transmit after transmit
+    for(double tOffset : {1.0, 100.0})
+    {
+        for(size_t tIndex = 0u; tIndex < tFields.size(); tIndex++)
+        {
+            setValues(*tFields[tIndex], tOffset + 20.0 * tIndex);
+        }
+        tBatch.transmitData();
+        for(size_t tIndex = 0u; tIndex < tFields.size(); tIndex++)
+        {
+            checkValues(*tFields[tIndex], tOffset + 20.0 * tIndex);
+        }
+    }
+}
+
+TEST(PlatoSharedField, sharedMemoryFieldsAreNotBatched)
+{
+    Plato::CommunicationData tCommData;
+    std::shared_ptr<Plato::SharedField> tFirst = makeField("Topology", tCommData);
+    std::shared_ptr<Plato::SharedField> tSecond = makeField("Control", tCommData);
+    tFirst->setCommunicationPattern("pattern");
+    tSecond->setCommunicationPattern("pattern");
+    std::vector<Plato::SharedData*> tSharedData = {tFirst.get(), tSecond.get()};
+    {
+        Plato::SharedDataBatch tBatch(tSharedData);
+        EXPECT_EQ(0, tBatch.getNumUnbatched());
+    }
+
+    tSecond->setSharedMemoryTransmit(true);
+    Plato::SharedDataBatch tBatch(tSharedData);
+    EXPECT_EQ(1, tBatch.getNumUnbatched());
+
+    setValues(*tFirst, 1.0);
+    setValues(*tSecond, 30.0);
+    tBatch.transmitData();
+    checkValues(*tFirst, 1.0);
+    checkValues(*tSecond, 30.0);
+}
+
+TEST(PlatoSharedField, overlappingProvidersCopyLocally)
+{
+    int tRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+
+    // every rank provides and receives every global id, so each one's own values
+    // are at hand and none are taken from the rank the directory names as owner
+    Plato::CommunicationData tCommData;
+    tCommData.mLocalComm = MPI_COMM_WORLD;
+    tCommData.mInterComm = MPI_COMM_WORLD;
+    std::vector<int> & tOwnedGlobalIDs = tCommData.mMyOwnedGlobalIDs[Plato::data::layout_t::SCALAR_FIELD];
+    for(int tGlobalID = 0; tGlobalID < cNumGlobalIDs; tGlobalID++)
+    {
+        tOwnedGlobalIDs.push_back(tGlobalID);
+    }
+    Plato::SharedField tField("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER, tCommData,
+                              Plato::data::layout_t::SCALAR_FIELD);
+
+    const double tOffset = 100.0 * (tRank + 1);
+    setValues(tField, tOffset);
+    tField.transmitData();
+    checkValues(tField, tOffset);
+
+    tField.setNonblockingTransmit(true);
+    setValues(tField, tOffset + 1.0);
+    tField.transmitData();
+    checkValues(tField, tOffset + 1.0);
+    tField.setNonblockingTransmit(false);
+}
+
+} // namespace SharedFieldTest
+} // namespace Plato
@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_StageRecorder.hpp"
+#include "Plato_Exceptions.hpp"
+
+#include <mpi.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace Plato
+{
+namespace StageRecorderTest
+{
+
+TEST(PlatoStageRecorder, writeAndReadRecording)
+{
+    int tRank = 0;
+    int tNumRanks = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    const std::string tFileName = "plato_stage_recording_test.txt";
+
+    // rank 0 drives the stages and owns the whole mesh; the other ranks split it
+    const std::string tPerformerName = tRank == 0 ? "PlatoMain" : "Physics";
+    Plato::StageRecorder tRecorder;
+    EXPECT_FALSE(tRecorder.isEnabled());
+    tRecorder.enable(MPI_COMM_WORLD, tPerformerName, tFileName);
+    EXPECT_TRUE(tRecorder.isEnabled());
+
+    tRecorder.recordOwnedIDs(Plato::data::layout_t::SCALAR_FIELD, tRank == 0 ? 20 : 10);
+    tRecorder.recordField("Topology", Plato::data::layout_t::SCALAR_FIELD, tRank == 0 ? 20 : 10);
+    tRecorder.recordField("Objective Value", Plato::data::layout_t::SCALAR, 1);
+    if(tRank == 0)
+    {
+        tRecorder.recordDriver();
+    }
+    for(int tIteration = 0; tIteration < 2; tIteration++)
+    {
+        tRecorder.recordStage("Objective", {"Topology", "Objective Value"});
+        if(tRank != 0)
+        {
+            tRecorder.recordCompute("Compute Objective", tIteration == 0 ? 0.1 * tRank : 0.2);
+        }
+    }
+    tRecorder.recordStage("Gradient", {"Topology"});
+    tRecorder.recordStage("Objective", {"Topology", "Objective Value"});
+    tRecorder.finalize();
+    EXPECT_FALSE(tRecorder.isEnabled());
+
+    if(tRank == 0)
+    {
+        Plato::StageRecording tRecording;
+        tRecording.read(tFileName);
+        std::remove(tFileName.c_str());
+
+        EXPECT_EQ("PlatoMain", tRecording.mDriver);
+        EXPECT_EQ(1, tRecording.mPerformerRanks["PlatoMain"]);
+        // consecutive executions of a stage come back as one run
+        ASSERT_EQ(3u, tRecording.mStages.size());
+        EXPECT_EQ("Objective", tRecording.mStages[0].mName);
+        EXPECT_EQ(2, tRecording.mStages[0].mRepeats);
+        EXPECT_EQ("Gradient", tRecording.mStages[1].mName);
+        EXPECT_EQ(1, tRecording.mStages[1].mRepeats);
+        EXPECT_EQ("Objective", tRecording.mStages[2].mName);
+        EXPECT_EQ(1, tRecording.mStages[2].mRepeats);
+        EXPECT_EQ(4, tRecording.numStages());
+        EXPECT_EQ(std::vector<std::string>({"Topology", "Objective Value"}), tRecording.mTransmits["Objective"]);
+        EXPECT_EQ(std::vector<std::string>({"Topology"}), tRecording.mTransmits["Gradient"]);
+
+        const int tGlobalIDs = std::max(20, 10 * (tNumRanks - 1));
+        EXPECT_EQ(tGlobalIDs, tRecording.mGlobalIDs["NODAL FIELD"]);
+        ASSERT_EQ(2u, tRecording.mFields.size());
+        EXPECT_EQ("Topology", tRecording.mFields[0].mName);
+        EXPECT_EQ("NODAL FIELD", tRecording.mFields[0].mLayout);
+        EXPECT_EQ(tGlobalIDs, tRecording.mFields[0].mSize);
+        EXPECT_EQ("GLOBAL", tRecording.mFields[1].mLayout);
+        EXPECT_EQ(1, tRecording.mFields[1].mSize);
+
+        // each statistic keeps the slowest rank of the performer
+        if(tNumRanks > 1)
+        {
+            EXPECT_EQ(tNumRanks - 1, tRecording.mPerformerRanks["Physics"]);
+            const Plato::ComputeTimes tTimes = tRecording.mComputeTimes["Physics"]["Compute Objective"];
+            const double tSlowest = 0.1 * (tNumRanks - 1);
+            EXPECT_EQ(2, tTimes.mCount);
+            EXPECT_NEAR(tSlowest + 0.2, tTimes.mTotal, 1e-12);
+            EXPECT_NEAR(std::min(tSlowest, 0.2), tTimes.mMin, 1e-12);
+            EXPECT_NEAR(std::max(tSlowest, 0.2), tTimes.mMax, 1e-12);
+            EXPECT_NEAR(0.5 * (tSlowest + 0.2), tTimes.mean(), 1e-12);
+        }
+    }
+}
+
+TEST(PlatoStageRecorder, computeTimesSummary)
+{
+    Plato::ComputeTimes tTimes;
+    EXPECT_EQ(0.0, tTimes.mean());
+    for(int tIndex = 0; tIndex < 1000; tIndex++)
+    {
+        tTimes.add(tIndex % 2 == 0 ? 0.5 : 1.5);
+    }
+    EXPECT_EQ(1000, tTimes.mCount);
+    EXPECT_NEAR(1000.0, tTimes.mTotal, 1e-9);
+    EXPECT_EQ(0.5, tTimes.mMin);
+    EXPECT_EQ(1.5, tTimes.mMax);
+    EXPECT_NEAR(1.0, tTimes.mean(), 1e-12);
+}
+
+TEST(PlatoStageRecorder, readRejectsOtherFiles)
+{
+    Plato::StageRecording tRecording;
+    EXPECT_THROW(tRecording.read("plato_stage_recording_does_not_exist.txt"), Plato::ParsingException);
+}
+
+} // namespace StageRecorderTest
+} // namespace Plato
@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_Stage.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Plato
+{
+namespace StageScheduleTest
+{
+
+Plato::Stage::Dependencies operation(const std::vector<std::string> & aInputs,
+                                     const std::vector<std::string> & aOutputs,
+                                     const std::string & aPerformer)
+{
+    Plato::Stage::Dependencies tDependencies;
+    tDependencies.mInputs = aInputs;
+    tDependencies.mOutputs = aOutputs;
+    tDependencies.mPerformers = {aPerformer};
+    return tDependencies;
+}
+
+TEST(PlatoStageSchedule, independentOperationsShareLevel)
+{
+    std::vector<Plato::Stage::Dependencies> tOperations;
+    tOperations.push_back(operation({"Topology"}, {"Load Case 1"}, "Physics 1"));
+    tOperations.push_back(operation({"Topology"}, {"Load Case 2"}, "Physics 2"));
+    tOperations.push_back(operation({"Load Case 1", "Load Case 2"}, {"Objective"}, "PlatoMain"));
+
+    std::vector<int> tLevels = Plato::Stage::computeLevels(tOperations);
+    ASSERT_EQ(3u, tLevels.size());
+    EXPECT_EQ(0, tLevels[0]);
+    EXPECT_EQ(0, tLevels[1]);
+    EXPECT_EQ(1, tLevels[2]);
+}
+
+TEST(PlatoStageSchedule, overwriteWaitsForEarlierReader)
+{
+    // the second operation overwrites the field the first one reads
+    std::vector<Plato::Stage::Dependencies> tOperations;
+    tOperations.push_back(operation({"Topology"}, {"Objective"}, "Physics 1"));
+    tOperations.push_back(operation({"Control"}, {"Topology"}, "Physics 2"));
+
+    std::vector<int> tLevels = Plato::Stage::computeLevels(tOperations);
+    ASSERT_EQ(2u, tLevels.size());
+    EXPECT_EQ(0, tLevels[0]);
+    EXPECT_EQ(1, tLevels[1]);
+}
+
+TEST(PlatoStageSchedule, writersOfSameDataKeepInputOrder)
+{
+    std::vector<Plato::Stage::Dependencies> tOperations;
+    tOperations.push_back(operation({"Control"}, {"Topology"}, "Physics 1"));
+    tOperations.push_back(operation({"Control"}, {"Topology"}, "Physics 2"));
+    tOperations.push_back(operation({"Control"}, {"Volume"}, "Physics 1"));
+
+    std::vector<int> tLevels = Plato::Stage::computeLevels(tOperations);
+    ASSERT_EQ(3u, tLevels.size());
+    EXPECT_EQ(0, tLevels[0]);
+    EXPECT_EQ(1, tLevels[1]);
+    // shares a performer with the first operation only
+    EXPECT_EQ(1, tLevels[2]);
+}
+
+} // namespace StageScheduleTest
+} // namespace Plato
@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_Tracer.hpp"
+
+#include <mpi.h>
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <sstream>
+
+namespace Plato
+{
+namespace TracerTest
+{
+
+TEST(PlatoTracer, disabledRecordsNothing)
+{
+    Plato::Tracer & tTracer = Plato::Tracer::get();
+    EXPECT_FALSE(tTracer.isEnabled());
+    {
+        Plato::TraceScope tScope("stage", "Objective");
+        tScope.addBytes(8);
+    }
+    EXPECT_EQ(0u, tTracer.getNumEvents());
+}
+
+TEST(PlatoTracer, nestedScopes)
+{
+    MPI_Comm tComm = MPI_COMM_WORLD;
+    int tRank = 0;
+    MPI_Comm_rank(tComm, &tRank);
+
+    Plato::Tracer & tTracer = Plato::Tracer::get();
+    const std::string tFileName("plato_tracer_test");
+    tTracer.enable(tComm, tFileName, 1, "PlatoMain");
+    EXPECT_TRUE(tTracer.isEnabled());
+
+    for(int tIteration = 0; tIteration < 2; tIteration++)
+    {
+        Plato::TraceScope tStageScope("stage", "Objective");
+        {
+            Plato::TraceScope tOperationScope("operation", "Compute Objective");
+            Plato::TraceScope tComputeScope("compute", "Compute Objective");
+        }
+        Plato::TraceScope tTransmitScope("transmit", "Objective Value");
+        tTransmitScope.addBytes(8);
+    }
+    EXPECT_EQ(8u, tTracer.getNumEvents());
+
+    std::string tSummary = tTracer.getSummary();
+    if(tRank == 0)
+    {
+        std::istringstream tLines(tSummary);
+        std::string tLine;
+        std::getline(tLines, tLine); // title
+        std::getline(tLines, tLine); // header
+        std::getline(tLines, tLine);
+        EXPECT_EQ(0u, tLine.find("Objective "));
+        std::getline(tLines, tLine);
+        EXPECT_EQ(0u, tLine.find("  Compute Objective "));
+        std::getline(tLines, tLine);
+        EXPECT_EQ(0u, tLine.find("    Compute Objective "));
+        EXPECT_NE(std::string::npos, tLine.find("compute"));
+        std::getline(tLines, tLine);
+        EXPECT_EQ(0u, tLine.find("  Objective Value "));
+        EXPECT_NE(std::string::npos, tLine.find("transmit"));
+    }
+    else
+    {
+        EXPECT_TRUE(tSummary.empty());
+    }
+
+    tTracer.finalize();
+    EXPECT_FALSE(tTracer.isEnabled());
+    EXPECT_EQ(0u, tTracer.getNumEvents());
+
+    std::ostringstream tTraceFileName;
+    tTraceFileName << tFileName << "." << tRank << ".json";
+    std::ifstream tTraceFile(tTraceFileName.str().c_str());
+    ASSERT_TRUE(tTraceFile.good());
+    std::stringstream tTrace;
+    tTrace << tTraceFile.rdbuf();
+    EXPECT_EQ(0u, tTrace.str().find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, tTrace.str().find("\"path\":\"Objective/Compute Objective/Compute Objective\""));
+    tTraceFile.close();
+    std::remove(tTraceFileName.str().c_str());
+
+    MPI_Barrier(tComm);
+    if(tRank == 0)
+    {
+        std::ifstream tSummaryFile((tFileName + "_summary.txt").c_str());
+        EXPECT_TRUE(tSummaryFile.good());
+        tSummaryFile.close();
+        std::remove((tFileName + "_summary.txt").c_str());
+    }
+}
+
+TEST(PlatoTracer, bufferIsFlushedWhenFull)
+{
+    MPI_Comm tComm = MPI_COMM_WORLD;
+    int tRank = 0;
+    MPI_Comm_rank(tComm, &tRank);
+
+    Plato::Tracer & tTracer = Plato::Tracer::get();
+    const std::string tFileName("plato_tracer_buffer_test");
+    const size_t tMaxBufferedEvents = 4;
+    tTracer.enable(tComm, tFileName, 1, "PlatoMain", tMaxBufferedEvents);
+
+    const size_t tNumIterations = 10;
+    for(size_t tIteration = 0; tIteration < tNumIterations; tIteration++)
+    {
+        Plato::TraceScope tStageScope("stage", "Objective");
+        EXPECT_LT(tTracer.getNumBufferedEvents(), tMaxBufferedEvents);
+    }
+    EXPECT_EQ(tNumIterations, tTracer.getNumEvents());
+    EXPECT_EQ(tNumIterations % tMaxBufferedEvents, tTracer.getNumBufferedEvents());
+    tTracer.finalize();
+
+    // every event is in the trace file
+    std::ostringstream tTraceFileName;
+    tTraceFileName << tFileName << "." << tRank << ".json";
+    std::ifstream tTraceFile(tTraceFileName.str().c_str());
+    ASSERT_TRUE(tTraceFile.good());
+    std::stringstream tTrace;
+    tTrace << tTraceFile.rdbuf();
+    size_t tNumTraceEvents = 0;
+    for(size_t tPosition = tTrace.str().find("\"ph\":\"X\""); tPosition != std::string::npos;
+            tPosition = tTrace.str().find("\"ph\":\"X\"", tPosition + 1))
+    {
+        tNumTraceEvents++;
+    }
+    EXPECT_EQ(tNumIterations, tNumTraceEvents);
+    EXPECT_EQ(tTrace.str().size() - 4, tTrace.str().rfind("\n]}\n"));
+    tTraceFile.close();
+    std::remove(tTraceFileName.str().c_str());
+
+    MPI_Barrier(tComm);
+    if(tRank == 0)
+    {
+        std::remove((tFileName + "_summary.txt").c_str());
+    }
+}
+
+} // namespace TracerTest
+} // namespace Plato
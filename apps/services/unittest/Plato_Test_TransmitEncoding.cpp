@@ -0,0 +1,124 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "Plato_TransmitEncoding.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Plato
+{
+namespace TransmitEncodingTest
+{
+
+std::vector<double> smooth_field(size_t aLength)
+{
+    // density-like field: mostly solid or void, smooth in between
+    std::vector<double> tValues(aLength);
+    for(size_t tIndex = 0; tIndex < aLength; tIndex++)
+    {
+        const double tX = static_cast<double>(tIndex) / aLength;
+        tValues[tIndex] = tX < 0.4 ? 1.0 : (tX > 0.6 ? 0.0 : 0.5 + 0.5 * std::cos(M_PI * (tX - 0.4) / 0.2));
+    }
+    return tValues;
+}
+
+TEST(PlatoTransmitEncoding, compressedIsLossless)
+{
+    std::vector<double> tValues = smooth_field(1000);
+    tValues[3] = -1.0e-300;
+    tValues[7] = std::numeric_limits<double>::max();
+
+    Plato::TransmitEncoding tEncoding(Plato::communication::encoding_t::COMPRESSED);
+    std::vector<unsigned char> tBytes(tEncoding.capacity(tValues.size()));
+    const size_t tNumBytes = tEncoding.encode(tValues.data(), tValues.size(), tBytes.data());
+    EXPECT_LT(tNumBytes, tValues.size() * sizeof(double) / 2);
+
+    std::vector<double> tDecoded(tValues.size());
+    tEncoding.decode(tBytes.data(), tNumBytes, tDecoded.size(), tDecoded.data());
+    EXPECT_EQ(tValues, tDecoded);
+}
+
+TEST(PlatoTransmitEncoding, compressedStaysWithinCapacity)
+{
+    // bytes with no runs can't be compressed; the output must still fit
+    std::vector<double> tValues(257);
+    unsigned long long tState = 12345;
+    for(double & tValue : tValues)
+    {
+        tState = tState * 6364136223846793005ULL + 1442695040888963407ULL;
+        tValue = static_cast<double>(tState >> 11) * 1.0e-10;
+    }
+
+    Plato::TransmitEncoding tEncoding(Plato::communication::encoding_t::COMPRESSED);
+    std::vector<unsigned char> tBytes(tEncoding.capacity(tValues.size()));
+    const size_t tNumBytes = tEncoding.encode(tValues.data(), tValues.size(), tBytes.data());
+    EXPECT_LE(tNumBytes, tBytes.size());
+
+    std::vector<double> tDecoded(tValues.size());
+    tEncoding.decode(tBytes.data(), tNumBytes, tDecoded.size(), tDecoded.data());
+    EXPECT_EQ(tValues, tDecoded);
+}
+
+TEST(PlatoTransmitEncoding, floatHalvesTheVolume)
+{
+    std::vector<double> tValues = {0.0, 1.0, -2.5, 1.0 / 3.0, 1.0e-12};
+
+    Plato::TransmitEncoding tEncoding(Plato::communication::encoding_t::FLOAT);
+    std::vector<unsigned char> tBytes(tEncoding.capacity(tValues.size()));
+    EXPECT_EQ(tValues.size() * sizeof(double) / 2, tBytes.size());
+    const size_t tNumBytes = tEncoding.encode(tValues.data(), tValues.size(), tBytes.data());
+    EXPECT_EQ(tBytes.size(), tNumBytes);
+
+    std::vector<double> tDecoded(tValues.size());
+    tEncoding.decode(tBytes.data(), tNumBytes, tDecoded.size(), tDecoded.data());
+    for(size_t tIndex = 0; tIndex < tValues.size(); tIndex++)
+    {
+        EXPECT_NEAR(tValues[tIndex], tDecoded[tIndex], 1e-7 * std::abs(tValues[tIndex]));
+    }
+}
+
+} // namespace TransmitEncodingTest
+} // namespace Plato
@@ -53,10 +53,13 @@
 // 6.  Ndof SharedField
 #include <cstdlib>
 #include <stdlib.h>
+#include <sstream>
+#include <algorithm>
 
 #include "Plato_Interface.hpp"
 #include "Plato_SharedField.hpp"
 #include "Plato_SharedValue.hpp"
+#include "Plato_SharedIntegerField.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_Communication.hpp"
 #include "Plato_SharedDataInfo.hpp"
@@ -79,16 +82,11 @@ DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato:
         std::string tMyLayout = aSharedDataInfo.getSharedDataLayout(tIndex);
 
         SharedData* tNewData = nullptr;
-        if(tMyLayout == "NODAL FIELD" )
+        if(tMyLayout == "NODAL FIELD" || tMyLayout == "ELEMENT FIELD")
         {
-            const Plato::communication::broadcast_t tBroadcastType = aSharedDataInfo.getMyBroadcast(tIndex);
-            tNewData = new Plato::SharedField(tMyName, tBroadcastType, aCommData,  Plato::data::layout_t::SCALAR_FIELD);
-        }
-        else 
-        if(tMyLayout == "ELEMENT FIELD")
-        {
-            const Plato::communication::broadcast_t tBroadcastType = aSharedDataInfo.getMyBroadcast(tIndex);
-            tNewData = new Plato::SharedField(tMyName, tBroadcastType, aCommData, Plato::data::layout_t::ELEMENT_FIELD);
+            const Plato::data::layout_t tLayout = tMyLayout == "NODAL FIELD" ?
+                    Plato::data::layout_t::SCALAR_FIELD : Plato::data::layout_t::ELEMENT_FIELD;
+            tNewData = this->createField(aSharedDataInfo, aCommData, tIndex, tLayout);
         }
         else 
         if(tMyLayout == "GLOBAL")
@@ -96,7 +94,10 @@ DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato:
             const int tSize = aSharedDataInfo.getSharedDataSize(tMyName);
             assert(tSize > static_cast<int>(0));
             std::vector<std::string> tMyProviderNames = aSharedDataInfo.getProviderNames(tIndex);
-            tNewData = new Plato::SharedValue(tMyName, tMyProviderNames, aCommData, tSize);
+            Plato::SharedValue* tNewValue = new Plato::SharedValue(tMyName, tMyProviderNames, aCommData, tSize);
+            tNewValue->setNonblockingTransmit(aSharedDataInfo.isNonblockingTransmit(tMyName));
+            tNewValue->setSkipUnmodifiedTransmits(aSharedDataInfo.isSkipUnmodifiedTransmits(tMyName));
+            tNewData = tNewValue;
         }
         else
         {
@@ -111,6 +112,70 @@ DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato:
     }
 }
 
+/******************************************************************************/
+SharedData* DataLayer::createField(const Plato::SharedDataInfo & aSharedDataInfo,
+                                   const Plato::CommunicationData & aCommData,
+                                   const int & aIndex,
+                                   Plato::data::layout_t aLayout) const
+/******************************************************************************/
+{
+    const std::string tMyName = aSharedDataInfo.getSharedDataName(aIndex);
+    const Plato::communication::broadcast_t tBroadcastType = aSharedDataInfo.getMyBroadcast(aIndex);
+    const int tNumComponents = aSharedDataInfo.getNumComponents(tMyName);
+
+    if(aSharedDataInfo.isIntegerData(tMyName))
+    {
+        // integer fields are always moved with a blocking import
+        if(aSharedDataInfo.isNonblockingTransmit(tMyName) || aSharedDataInfo.isSharedMemoryTransmit(tMyName)
+           || aSharedDataInfo.getTransmitEncoding(tMyName) != Plato::communication::encoding_t::DOUBLE)
+        {
+            std::stringstream ss;
+            ss << "Plato::DataLayer: integer SharedData ('" << tMyName
+               << "') doesn't support NonblockingTransmit, SharedMemoryTransmit, or TransmitEncoding.";
+            throw ParsingException(ss.str());
+        }
+        Plato::SharedIntegerField* tNewField =
+                new Plato::SharedIntegerField(tMyName, tBroadcastType, aCommData, aLayout, tNumComponents);
+        tNewField->setSkipUnmodifiedTransmits(aSharedDataInfo.isSkipUnmodifiedTransmits(tMyName));
+        return tNewField;
+    }
+
+    Plato::SharedField* tNewField = new Plato::SharedField(tMyName, tBroadcastType, aCommData, aLayout, tNumComponents);
+    tNewField->setCommunicationPattern(this->getCommunicationPattern(aSharedDataInfo, aIndex));
+    tNewField->setNonblockingTransmit(aSharedDataInfo.isNonblockingTransmit(tMyName));
+    tNewField->setSharedMemoryTransmit(aSharedDataInfo.isSharedMemoryTransmit(tMyName));
+    tNewField->setTransmitEncoding(aSharedDataInfo.getTransmitEncoding(tMyName));
+    tNewField->setSkipUnmodifiedTransmits(aSharedDataInfo.isSkipUnmodifiedTransmits(tMyName));
+    return tNewField;
+}
+
+/******************************************************************************/
+std::string DataLayer::getCommunicationPattern(const Plato::SharedDataInfo & aSharedDataInfo, const int & aIndex) const
+/******************************************************************************/
+{
+    // A field's maps are determined by its layout, its number of components, and by
+    // which performers provide and receive it.  Fields that agree on all four have
+    // identical maps on every rank and can be moved with the same import.
+    std::vector<std::string> tProviderNames = aSharedDataInfo.getProviderNames(aIndex);
+    std::vector<std::string> tReceiverNames = aSharedDataInfo.getReceiverNames(aIndex);
+    std::sort(tProviderNames.begin(), tProviderNames.end());
+    std::sort(tReceiverNames.begin(), tReceiverNames.end());
+
+    std::stringstream tPattern;
+    tPattern << aSharedDataInfo.getSharedDataLayout(aIndex) << ";";
+    tPattern << aSharedDataInfo.getNumComponents(aSharedDataInfo.getSharedDataName(aIndex)) << ";";
+    for(const std::string & tName : tProviderNames)
+    {
+        tPattern << tName << ",";
+    }
+    tPattern << ";";
+    for(const std::string & tName : tReceiverNames)
+    {
+        tPattern << tName << ",";
+    }
+    return tPattern.str();
+}
+
 /******************************************************************************/
 DataLayer::~DataLayer()
 /******************************************************************************/
@@ -148,5 +213,71 @@ const std::vector<SharedData*> & DataLayer::getSharedData() const
     return mSharedData;
 }
 
+/******************************************************************************/
+int DataLayer::getSharedDataIndex(const std::string & aName) const
+/******************************************************************************/
+{
+    SharedData* tSharedData = this->getSharedData(aName);
+    auto tIterator = std::find(mSharedData.begin(), mSharedData.end(), tSharedData);
+    return static_cast<int>(std::distance(mSharedData.begin(), tIterator));
+}
+
+/******************************************************************************/
+SharedData* DataLayer::getSharedData(int aIndex) const
+/******************************************************************************/
+{
+    if(aIndex < 0 || aIndex >= static_cast<int>(mSharedData.size()))
+    {
+        std::stringstream ss;
+        ss << "Plato::DataLayer: request for SharedData with invalid handle (" << aIndex << ").";
+        throw ParsingException(ss.str());
+    }
+    return mSharedData[aIndex];
+}
+
+/******************************************************************************/
+int DataLayer::getNumTransmits() const
+/******************************************************************************/
+{
+    int tNumTransmits = 0;
+    for(SharedData* tSharedData : mSharedData)
+    {
+        tNumTransmits += tSharedData->getNumTransmits();
+    }
+    return tNumTransmits;
+}
+
+/******************************************************************************/
+int DataLayer::getNumSkippedTransmits() const
+/******************************************************************************/
+{
+    int tNumSkippedTransmits = 0;
+    for(SharedData* tSharedData : mSharedData)
+    {
+        tNumSkippedTransmits += tSharedData->getNumSkippedTransmits();
+    }
+    return tNumSkippedTransmits;
+}
+
+/******************************************************************************/
+void DataLayer::writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+/******************************************************************************/
+{
+    for(SharedData* tSharedData : mSharedData)
+    {
+        tSharedData->writeCheckpoint(aWriter);
+    }
+}
+
+/******************************************************************************/
+void DataLayer::readCheckpoint(const Plato::CheckpointReader & aReader)
+/******************************************************************************/
+{
+    for(SharedData* tSharedData : mSharedData)
+    {
+        tSharedData->readCheckpoint(aReader);
+    }
+}
+
 } /* namespace Plato */
 
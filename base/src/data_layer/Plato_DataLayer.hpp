@@ -54,11 +54,15 @@
 #include <vector>
 #include <string>
 
+#include "Plato_SharedData.hpp"
+
 namespace Plato
 {
 
 class SharedData;
 class SharedDataInfo;
+class CheckpointWriter;
+class CheckpointReader;
 struct CommunicationData;
 
 /******************************************************************************/
@@ -76,6 +80,25 @@ public:
     SharedData* getSharedData(const std::string & aName) const;
     const std::vector<SharedData*> & getSharedData() const;
 
+    // integer handles resolved once, for lookups on the per-iteration path
+    int getSharedDataIndex(const std::string & aName) const;
+    SharedData* getSharedData(int aIndex) const;
+
+    // transmit counts summed over all shared data, for profiling
+    int getNumTransmits() const;
+    int getNumSkippedTransmits() const;
+
+    // this rank's values of every shared data, for checkpoint/restart
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const;
+    void readCheckpoint(const Plato::CheckpointReader & aReader);
+
+private:
+    SharedData* createField(const Plato::SharedDataInfo & aSharedDataInfo,
+                            const Plato::CommunicationData & aCommData,
+                            const int & aIndex,
+                            Plato::data::layout_t aLayout) const;
+    std::string getCommunicationPattern(const Plato::SharedDataInfo & aSharedDataInfo, const int & aIndex) const;
+
 private:
     std::vector<SharedData*> mSharedData;
     std::map<std::string, SharedData*> mSharedDataMap;
@@ -0,0 +1,566 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_FieldTransmitPlan.cpp
+ *
+ */
+
+#include <numeric>
+#include <algorithm>
+
+#include <Epetra_BlockMap.h>
+
+#include "Plato_FieldTransmitPlan.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+FieldTransmitPlan::FieldTransmitPlan(const Epetra_BlockMap & aProvidedMap,
+                                     const Epetra_BlockMap & aReceivedMap,
+                                     MPI_Comm aComm,
+                                     bool aUseSharedMemory) :
+        mComm(MPI_COMM_NULL),
+        mNumComponents(aProvidedMap.ElementSize()),
+        mSendProcs(),
+        mSendOffsets(),
+        mSendLIDs(),
+        mRecvProcs(),
+        mRecvOffsets(),
+        mRecvLIDs(),
+        mUnmatchedLIDs(),
+        mLocalProvidedLIDs(),
+        mLocalRecvLIDs(),
+        mSendBuffer(),
+        mRecvBuffer(),
+        mRequests(),
+        mIsPending(false),
+        mIsPersistent(false),
+        mEncoding(),
+        mSendBytes(),
+        mRecvBytes(),
+        mSendByteOffsets(),
+        mRecvByteOffsets(),
+        mUseSharedMemory(aUseSharedMemory),
+        mNodeComm(MPI_COMM_NULL),
+        mWindow(MPI_WIN_NULL),
+        mSegment(nullptr),
+        mNumProvided(0),
+        mHasNodeReaders(false),
+        mSharedSources(),
+        mSharedOwnerLIDs(),
+        mSharedRecvLIDs()
+/******************************************************************************/
+{
+    // private communicator so messages from different fields can't be confused
+    MPI_Comm_dup(aComm, &mComm);
+    this->initialize(aProvidedMap, aReceivedMap);
+}
+
+/******************************************************************************/
+FieldTransmitPlan::~FieldTransmitPlan()
+/******************************************************************************/
+{
+    int tIsFinalized = 0;
+    MPI_Finalized(&tIsFinalized);
+    if(tIsFinalized == 0)
+    {
+        if(mIsPending)
+        {
+            MPI_Waitall(mRequests.size(), mRequests.data(), MPI_STATUSES_IGNORE);
+        }
+        this->freeRequests();
+        if(mWindow != MPI_WIN_NULL)
+        {
+            MPI_Win_unlock_all(mWindow);
+            MPI_Win_free(&mWindow);
+        }
+        if(mNodeComm != MPI_COMM_NULL)
+        {
+            MPI_Comm_free(&mNodeComm);
+        }
+        MPI_Comm_free(&mComm);
+    }
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::initialize(const Epetra_BlockMap & aProvidedMap, const Epetra_BlockMap & aReceivedMap)
+/******************************************************************************/
+{
+    int tNumProcs = 0;
+    MPI_Comm_size(mComm, &tNumProcs);
+
+    // find the owning rank and the owner's local id of each received entry
+    //
+    const int tNumRecv = aReceivedMap.NumMyElements();
+    std::vector<int> tRecvGIDs(tNumRecv);
+    aReceivedMap.MyGlobalElements(tRecvGIDs.data());
+    std::vector<int> tOwnerPIDs(tNumRecv, -1);
+    std::vector<int> tOwnerLIDs(tNumRecv, -1);
+    aProvidedMap.RemoteIDList(tNumRecv, tRecvGIDs.data(), tOwnerPIDs.data(), tOwnerLIDs.data());
+
+    // entries this rank provides itself are copied locally, even where the
+    // directory names another rank as their owner
+    //
+    std::vector<bool> tIsLocal(tNumRecv, false);
+    for(int tIndex = 0; tIndex < tNumRecv; tIndex++)
+    {
+        const int tProvidedLID = aProvidedMap.LID(tRecvGIDs[tIndex]);
+        if(tProvidedLID >= 0)
+        {
+            tIsLocal[tIndex] = true;
+            mLocalProvidedLIDs.push_back(tProvidedLID);
+            mLocalRecvLIDs.push_back(tIndex);
+        }
+    }
+
+    // node rank of each rank in mComm, or -1 if it lives on another node
+    //
+    std::vector<int> tNodeRanks(tNumProcs, -1);
+    if(mUseSharedMemory)
+    {
+        tNodeRanks = this->findNodeRanks();
+    }
+
+    // group the received entries by owner; entries owned on this node are
+    // read from the owner's window segment and never go through MPI
+    //
+    std::vector<int> tRequestCounts(tNumProcs, 0);
+    for(int tIndex = 0; tIndex < tNumRecv; tIndex++)
+    {
+        const int tOwner = tOwnerPIDs[tIndex];
+        if(tIsLocal[tIndex])
+        {
+            continue;
+        }
+        else if(tOwner < 0)
+        {
+            mUnmatchedLIDs.push_back(tIndex);
+        }
+        else if(tNodeRanks[tOwner] >= 0)
+        {
+            mSharedOwnerLIDs.push_back(tOwnerLIDs[tIndex]);
+            mSharedRecvLIDs.push_back(tIndex);
+        }
+        else
+        {
+            tRequestCounts[tOwner]++;
+        }
+    }
+    std::vector<int> tRequestOffsets(tNumProcs + 1, 0);
+    std::partial_sum(tRequestCounts.begin(), tRequestCounts.end(), tRequestOffsets.begin() + 1);
+
+    std::vector<int> tRequestedLIDs(tRequestOffsets.back());
+    mRecvLIDs.resize(tRequestOffsets.back());
+    std::vector<int> tFill(tRequestOffsets.begin(), tRequestOffsets.end() - 1);
+    for(int tIndex = 0; tIndex < tNumRecv; tIndex++)
+    {
+        const int tOwner = tOwnerPIDs[tIndex];
+        if(tIsLocal[tIndex] == false && tOwner >= 0 && tNodeRanks[tOwner] < 0)
+        {
+            tRequestedLIDs[tFill[tOwner]] = tOwnerLIDs[tIndex];
+            mRecvLIDs[tFill[tOwner]] = tIndex;
+            tFill[tOwner]++;
+        }
+    }
+
+    // tell each owner which of its entries this rank needs
+    //
+    std::vector<int> tSendCounts(tNumProcs, 0);
+    MPI_Alltoall(tRequestCounts.data(), 1, MPI_INT, tSendCounts.data(), 1, MPI_INT, mComm);
+    std::vector<int> tSendOffsets(tNumProcs + 1, 0);
+    std::partial_sum(tSendCounts.begin(), tSendCounts.end(), tSendOffsets.begin() + 1);
+
+    std::vector<int> tSendLIDs(tSendOffsets.back());
+    MPI_Alltoallv(tRequestedLIDs.data(), tRequestCounts.data(), tRequestOffsets.data(), MPI_INT,
+                  tSendLIDs.data(), tSendCounts.data(), tSendOffsets.data(), MPI_INT, mComm);
+    mSendLIDs = tSendLIDs;
+
+    // keep only the ranks that actually exchange data
+    //
+    mSendOffsets.push_back(0);
+    mRecvOffsets.push_back(0);
+    for(int tProc = 0; tProc < tNumProcs; tProc++)
+    {
+        if(tSendCounts[tProc] > 0)
+        {
+            mSendProcs.push_back(tProc);
+            mSendOffsets.push_back(tSendOffsets[tProc + 1]);
+        }
+        if(tRequestCounts[tProc] > 0)
+        {
+            mRecvProcs.push_back(tProc);
+            mRecvOffsets.push_back(tRequestOffsets[tProc + 1]);
+        }
+    }
+
+    mSendBuffer.resize(mSendLIDs.size() * mNumComponents);
+    mRecvBuffer.resize(mRecvLIDs.size() * mNumComponents);
+    mRequests.resize(mSendProcs.size() + mRecvProcs.size(), MPI_REQUEST_NULL);
+    this->createRequests();
+
+    if(mUseSharedMemory)
+    {
+        // node-local reads need the node synchronized around them; without any, post() skips it
+        int tIsNodeReader = mSharedRecvLIDs.empty() ? 0 : 1;
+        int tNumNodeReaders = 0;
+        MPI_Allreduce(&tIsNodeReader, &tNumNodeReaders, 1, MPI_INT, MPI_SUM, mNodeComm);
+        mHasNodeReaders = tNumNodeReaders > 0;
+
+        std::vector<int> tSourceNodeRanks(mSharedRecvLIDs.size());
+        int tSharedIndex = 0;
+        for(int tIndex = 0; tIndex < tNumRecv; tIndex++)
+        {
+            const int tOwner = tOwnerPIDs[tIndex];
+            if(tIsLocal[tIndex] == false && tOwner >= 0 && tNodeRanks[tOwner] >= 0)
+            {
+                tSourceNodeRanks[tSharedIndex++] = tNodeRanks[tOwner];
+            }
+        }
+        this->initializeSharedMemory(tSourceNodeRanks, aProvidedMap.NumMyElements());
+    }
+}
+
+/******************************************************************************/
+std::vector<int> FieldTransmitPlan::findNodeRanks()
+/******************************************************************************/
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(mComm, &tMyRank);
+    MPI_Comm_split_type(mComm, MPI_COMM_TYPE_SHARED, tMyRank, MPI_INFO_NULL, &mNodeComm);
+
+    int tNumNodeProcs = 0;
+    MPI_Comm_size(mNodeComm, &tNumNodeProcs);
+    std::vector<int> tNodeRanks(tNumNodeProcs);
+    std::iota(tNodeRanks.begin(), tNodeRanks.end(), 0);
+    std::vector<int> tCommRanks(tNumNodeProcs, MPI_UNDEFINED);
+
+    MPI_Group tNodeGroup, tCommGroup;
+    MPI_Comm_group(mNodeComm, &tNodeGroup);
+    MPI_Comm_group(mComm, &tCommGroup);
+    MPI_Group_translate_ranks(tNodeGroup, tNumNodeProcs, tNodeRanks.data(), tCommGroup, tCommRanks.data());
+    MPI_Group_free(&tNodeGroup);
+    MPI_Group_free(&tCommGroup);
+
+    int tNumProcs = 0;
+    MPI_Comm_size(mComm, &tNumProcs);
+    std::vector<int> tOutput(tNumProcs, -1);
+    for(int tNodeRank = 0; tNodeRank < tNumNodeProcs; tNodeRank++)
+    {
+        tOutput[tCommRanks[tNodeRank]] = tNodeRank;
+    }
+    return tOutput;
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::initializeSharedMemory(const std::vector<int> & aNodeRanks, int aNumProvided)
+/******************************************************************************/
+{
+    // each segment stays on its owner's NUMA domain
+    MPI_Info tInfo;
+    MPI_Info_create(&tInfo);
+    MPI_Info_set(tInfo, "alloc_shared_noncontig", "true");
+
+    mNumProvided = aNumProvided;
+    const MPI_Aint tBytes = static_cast<MPI_Aint>(mNumProvided) * mNumComponents * sizeof(double);
+    MPI_Win_allocate_shared(tBytes, sizeof(double), tInfo, mNodeComm, &mSegment, &mWindow);
+    MPI_Info_free(&tInfo);
+
+    std::fill(mSegment, mSegment + mNumProvided * mNumComponents, 0.0);
+
+    // passive-target epoch for the plan's lifetime; post() orders the accesses
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, mWindow);
+
+    mSharedSources.resize(aNodeRanks.size(), nullptr);
+    const int tNumShared = aNodeRanks.size();
+    for(int tIndex = 0; tIndex < tNumShared; tIndex++)
+    {
+        MPI_Aint tSize = 0;
+        int tDisplacementUnit = 0;
+        double* tBase = nullptr;
+        MPI_Win_shared_query(mWindow, aNodeRanks[tIndex], &tSize, &tDisplacementUnit, &tBase);
+        mSharedSources[tIndex] = tBase;
+    }
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::createRequests()
+/******************************************************************************/
+{
+    this->freeRequests();
+
+    // messages of fixed length go through persistent requests, set up once and
+    // restarted by every post(); encoded messages vary in length and are posted each time
+    mIsPersistent = mEncoding.type() == Plato::communication::encoding_t::DOUBLE;
+    if(mIsPersistent == false)
+    {
+        return;
+    }
+
+    const int tTag = 0;
+    int tRequestIndex = 0;
+    const int tNumRecvProcs = mRecvProcs.size();
+    for(int tIndex = 0; tIndex < tNumRecvProcs; tIndex++)
+    {
+        const int tBegin = mRecvOffsets[tIndex] * mNumComponents;
+        const int tLength = (mRecvOffsets[tIndex + 1] - mRecvOffsets[tIndex]) * mNumComponents;
+        MPI_Recv_init(mRecvBuffer.data() + tBegin, tLength, MPI_DOUBLE, mRecvProcs[tIndex], tTag, mComm, &mRequests[tRequestIndex++]);
+    }
+    const int tNumSendProcs = mSendProcs.size();
+    for(int tIndex = 0; tIndex < tNumSendProcs; tIndex++)
+    {
+        const int tBegin = mSendOffsets[tIndex] * mNumComponents;
+        const int tLength = (mSendOffsets[tIndex + 1] - mSendOffsets[tIndex]) * mNumComponents;
+        MPI_Send_init(mSendBuffer.data() + tBegin, tLength, MPI_DOUBLE, mSendProcs[tIndex], tTag, mComm, &mRequests[tRequestIndex++]);
+    }
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::freeRequests()
+/******************************************************************************/
+{
+    if(mIsPersistent)
+    {
+        for(MPI_Request & tRequest : mRequests)
+        {
+            MPI_Request_free(&tRequest);
+        }
+    }
+    std::fill(mRequests.begin(), mRequests.end(), MPI_REQUEST_NULL);
+    mIsPersistent = false;
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::post(const double* aSendData, double* aRecvData)
+/******************************************************************************/
+{
+    const int tTag = 0;
+    const int tNumRecvProcs = mRecvProcs.size();
+    const int tNumSendProcs = mSendProcs.size();
+
+    if(mIsPersistent)
+    {
+        if(tNumRecvProcs > 0)
+        {
+            MPI_Startall(tNumRecvProcs, mRequests.data());
+        }
+    }
+    else
+    {
+        for(int tIndex = 0; tIndex < tNumRecvProcs; tIndex++)
+        {
+            // the encoded size isn't known in advance, so post the largest it can be
+            const int tCapacity = mRecvByteOffsets[tIndex + 1] - mRecvByteOffsets[tIndex];
+            MPI_Irecv(mRecvBytes.data() + mRecvByteOffsets[tIndex], tCapacity, MPI_BYTE, mRecvProcs[tIndex], tTag, mComm, &mRequests[tIndex]);
+        }
+    }
+
+    // pack the whole send buffer up front; the caller may overwrite aSendData
+    // as soon as this returns
+    const int tNumSendEntries = mSendLIDs.size();
+    for(int tIndex = 0; tIndex < tNumSendEntries; tIndex++)
+    {
+        this->copyEntry(aSendData, mSendLIDs[tIndex], mSendBuffer.data(), tIndex);
+    }
+
+    if(mIsPersistent)
+    {
+        if(tNumSendProcs > 0)
+        {
+            MPI_Startall(tNumSendProcs, mRequests.data() + tNumRecvProcs);
+        }
+    }
+    else
+    {
+        for(int tIndex = 0; tIndex < tNumSendProcs; tIndex++)
+        {
+            const int tBegin = mSendOffsets[tIndex] * mNumComponents;
+            const int tLength = (mSendOffsets[tIndex + 1] - mSendOffsets[tIndex]) * mNumComponents;
+            unsigned char* tBytes = mSendBytes.data() + mSendByteOffsets[tIndex];
+            const int tNumBytes = mEncoding.encode(mSendBuffer.data() + tBegin, tLength, tBytes);
+            MPI_Isend(tBytes, tNumBytes, MPI_BYTE, mSendProcs[tIndex], tTag, mComm, &mRequests[tNumRecvProcs + tIndex]);
+        }
+    }
+
+    // entries this rank provides itself never leave it
+    const int tNumLocalEntries = mLocalRecvLIDs.size();
+    for(int tIndex = 0; tIndex < tNumLocalEntries; tIndex++)
+    {
+        this->copyEntry(aSendData, mLocalProvidedLIDs[tIndex], aRecvData, mLocalRecvLIDs[tIndex]);
+    }
+
+    if(mUseSharedMemory)
+    {
+        this->readNodeLocal(aSendData, aRecvData);
+    }
+
+    mIsPending = true;
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::readNodeLocal(const double* aSendData, double* aRecvData)
+/******************************************************************************/
+{
+    if(mHasNodeReaders == false)
+    {
+        return;
+    }
+    // a provider whose field isn't stored in its segment publishes a copy
+    if(aSendData != mSegment)
+    {
+        std::copy(aSendData, aSendData + mNumProvided * mNumComponents, mSegment);
+    }
+
+    // the first barrier makes the providers' values visible, the second keeps
+    // them from being overwritten until every node-local reader is done
+    MPI_Win_sync(mWindow);
+    MPI_Barrier(mNodeComm);
+    MPI_Win_sync(mWindow);
+    const int tNumSharedEntries = mSharedRecvLIDs.size();
+    for(int tIndex = 0; tIndex < tNumSharedEntries; tIndex++)
+    {
+        this->copyEntry(mSharedSources[tIndex], mSharedOwnerLIDs[tIndex], aRecvData, mSharedRecvLIDs[tIndex]);
+    }
+    MPI_Barrier(mNodeComm);
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::complete(double* aRecvData)
+/******************************************************************************/
+{
+    if(mIsPending == false)
+    {
+        return;
+    }
+
+    MPI_Waitall(mRequests.size(), mRequests.data(), MPI_STATUSES_IGNORE);
+    mIsPending = false;
+
+    if(mEncoding.type() != Plato::communication::encoding_t::DOUBLE)
+    {
+        const int tNumRecvProcs = mRecvProcs.size();
+        for(int tIndex = 0; tIndex < tNumRecvProcs; tIndex++)
+        {
+            const int tBegin = mRecvOffsets[tIndex] * mNumComponents;
+            const int tLength = (mRecvOffsets[tIndex + 1] - mRecvOffsets[tIndex]) * mNumComponents;
+            const size_t tCapacity = mRecvByteOffsets[tIndex + 1] - mRecvByteOffsets[tIndex];
+            mEncoding.decode(mRecvBytes.data() + mRecvByteOffsets[tIndex], tCapacity, tLength, mRecvBuffer.data() + tBegin);
+        }
+    }
+
+    // same result as zeroing the receive vector and importing with 'Insert'
+    for(int tLID : mUnmatchedLIDs)
+    {
+        std::fill(aRecvData + tLID * mNumComponents, aRecvData + (tLID + 1) * mNumComponents, 0.0);
+    }
+    const int tNumRecvEntries = mRecvLIDs.size();
+    for(int tIndex = 0; tIndex < tNumRecvEntries; tIndex++)
+    {
+        this->copyEntry(mRecvBuffer.data(), tIndex, aRecvData, mRecvLIDs[tIndex]);
+    }
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::copyEntry(const double* aFrom, int aFromLID, double* aTo, int aToLID) const
+/******************************************************************************/
+{
+    const double* tFrom = aFrom + aFromLID * mNumComponents;
+    std::copy(tFrom, tFrom + mNumComponents, aTo + aToLID * mNumComponents);
+}
+
+/******************************************************************************/
+bool FieldTransmitPlan::isPending() const
+/******************************************************************************/
+{
+    return mIsPending;
+}
+
+/******************************************************************************/
+bool FieldTransmitPlan::isSharedMemory() const
+/******************************************************************************/
+{
+    return mUseSharedMemory;
+}
+
+/******************************************************************************/
+double* FieldTransmitPlan::getSendSegment() const
+/******************************************************************************/
+{
+    // node-local peers read the provided values from here; null without shared memory
+    return mSegment;
+}
+
+/******************************************************************************/
+void FieldTransmitPlan::setEncoding(Plato::communication::encoding_t aEncoding)
+/******************************************************************************/
+{
+    mEncoding = Plato::TransmitEncoding(aEncoding);
+
+    // one byte range per peer, each large enough for the worst case encoding of its entries
+    mSendByteOffsets.assign(1, 0);
+    for(size_t tIndex = 0; tIndex + 1 < mSendOffsets.size(); tIndex++)
+    {
+        const size_t tLength = (mSendOffsets[tIndex + 1] - mSendOffsets[tIndex]) * mNumComponents;
+        mSendByteOffsets.push_back(mSendByteOffsets.back() + mEncoding.capacity(tLength));
+    }
+    mRecvByteOffsets.assign(1, 0);
+    for(size_t tIndex = 0; tIndex + 1 < mRecvOffsets.size(); tIndex++)
+    {
+        const size_t tLength = (mRecvOffsets[tIndex + 1] - mRecvOffsets[tIndex]) * mNumComponents;
+        mRecvByteOffsets.push_back(mRecvByteOffsets.back() + mEncoding.capacity(tLength));
+    }
+
+    const bool tIsEncoded = aEncoding != Plato::communication::encoding_t::DOUBLE;
+    mSendBytes.resize(tIsEncoded ? mSendByteOffsets.back() : 0);
+    mRecvBytes.resize(tIsEncoded ? mRecvByteOffsets.back() : 0);
+    this->createRequests();
+}
+
+/******************************************************************************/
+Plato::communication::encoding_t FieldTransmitPlan::getEncoding() const
+/******************************************************************************/
+{
+    return mEncoding.type();
+}
+
+} // End namespace Plato
@@ -0,0 +1,162 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_FieldTransmitPlan.hpp
+ *
+ */
+
+#ifndef SRC_FIELDTRANSMITPLAN_HPP_
+#define SRC_FIELDTRANSMITPLAN_HPP_
+
+#include <vector>
+
+#include "mpi.h"
+
+#include "Plato_TransmitEncoding.hpp"
+
+class Epetra_BlockMap;
+
+namespace Plato
+{
+
+/******************************************************************************/
+//!  Point-to-point communication plan for a SharedField
+/*!
+ Moves the same entries an Epetra_Import from the provided map to the received
+ map would move, but as separate post and complete phases so the transfer can
+ overlap other work.  Send and receive lists are resolved once at construction,
+ along with persistent MPI requests that each post() restarts; only entries
+ nobody provides are zeroed on completion.  Entries a rank provides itself are
+ copied in post() without going through MPI, as Epetra_Import's same/permute
+ step does, even when another rank provides them too.
+ Each entry is one element of the maps, which may hold several (interleaved)
+ values.
+ Construction is collective over aComm.
+
+ With aUseSharedMemory, ranks that share a node exchange entries through an
+ MPI-3 shared-memory window instead of messages.  Each rank's window segment is
+ sized to the provided map and is meant to be the provided field's storage (see
+ getSendSegment()); post() then reads node-local entries straight from the
+ owners' segments into the received values, and only off-node peers go through
+ MPI.  The node-local part is finished when post() returns, so a provider may
+ overwrite its segment afterwards.  post() is collective over aComm, which
+ SharedField transmits already are; nodes where no rank reads a node-local
+ entry skip the node synchronization.
+
+ setEncoding() changes how the values sent through MPI are put on the wire
+ (see TransmitEncoding); node-local shared-memory reads are not affected.
+ */
+/******************************************************************************/
+class FieldTransmitPlan
+{
+public:
+    FieldTransmitPlan(const Epetra_BlockMap & aProvidedMap,
+                      const Epetra_BlockMap & aReceivedMap,
+                      MPI_Comm aComm,
+                      bool aUseSharedMemory = false);
+    ~FieldTransmitPlan();
+
+    void post(const double* aSendData, double* aRecvData);
+    void complete(double* aRecvData);
+    bool isPending() const;
+    bool isSharedMemory() const;
+    double* getSendSegment() const;
+
+    // every rank of aComm must set the same encoding, with no transfer pending
+    void setEncoding(Plato::communication::encoding_t aEncoding);
+    Plato::communication::encoding_t getEncoding() const;
+
+private:
+    void initialize(const Epetra_BlockMap & aProvidedMap, const Epetra_BlockMap & aReceivedMap);
+    void copyEntry(const double* aFrom, int aFromLID, double* aTo, int aToLID) const;
+    void createRequests();
+    void freeRequests();
+    std::vector<int> findNodeRanks();
+    void initializeSharedMemory(const std::vector<int> & aNodeRanks, int aNumProvided);
+    void readNodeLocal(const double* aSendData, double* aRecvData);
+
+private:
+    MPI_Comm mComm;
+    int mNumComponents;              /*!< values per entry (the maps' element size) */
+
+    std::vector<int> mSendProcs;
+    std::vector<int> mSendOffsets;
+    std::vector<int> mSendLIDs;      /*!< provided-map local ids, grouped by destination */
+
+    std::vector<int> mRecvProcs;
+    std::vector<int> mRecvOffsets;
+    std::vector<int> mRecvLIDs;      /*!< received-map local ids, grouped by source */
+    std::vector<int> mUnmatchedLIDs; /*!< received entries nobody provides */
+    std::vector<int> mLocalProvidedLIDs; /*!< provided-map local ids of entries this rank provides itself */
+    std::vector<int> mLocalRecvLIDs;     /*!< received-map local ids of those entries */
+
+    std::vector<double> mSendBuffer;
+    std::vector<double> mRecvBuffer;
+    std::vector<MPI_Request> mRequests;  /*!< receives first, then sends */
+    bool mIsPending;
+    bool mIsPersistent;                  /*!< mRequests were made by MPI_Recv_init/MPI_Send_init */
+
+    Plato::TransmitEncoding mEncoding;
+    std::vector<unsigned char> mSendBytes;
+    std::vector<unsigned char> mRecvBytes;
+    std::vector<size_t> mSendByteOffsets; /*!< per destination, spaced by the encoding's capacity */
+    std::vector<size_t> mRecvByteOffsets; /*!< per source, spaced by the encoding's capacity */
+
+    bool mUseSharedMemory;
+    MPI_Comm mNodeComm;
+    MPI_Win mWindow;
+    double* mSegment;                /*!< this rank's window segment, sized to the provided map */
+    int mNumProvided;
+    bool mHasNodeReaders;            /*!< some rank on this node reads node-local entries */
+    std::vector<const double*> mSharedSources; /*!< owners' segments, one per shared receive entry */
+    std::vector<int> mSharedOwnerLIDs;  /*!< provided-map local ids on the owner */
+    std::vector<int> mSharedRecvLIDs;   /*!< received-map local ids */
+
+private:
+    FieldTransmitPlan(const FieldTransmitPlan& aRhs);
+    FieldTransmitPlan& operator=(const FieldTransmitPlan& aRhs);
+};
+
+} // End namespace Plato
+
+#endif
@@ -52,11 +52,16 @@
 
 #include <string>
 #include <vector>
+#include <cmath>
 #include <cassert>
+#include <algorithm>
 
 namespace Plato
 {
 
+class CheckpointWriter;
+class CheckpointReader;
+
 //!  Inter-program shared data
 /*!
  */
@@ -84,6 +89,35 @@ public:
     virtual void transmitData() = 0;
     virtual void setData(const std::vector<double> & aData) = 0;
     virtual void getData(std::vector<double> & aData) const = 0;
+
+    //! Integer access; data stored as doubles is converted (rounded on the way out)
+    virtual void setIntegerData(const std::vector<int> & aData)
+    {
+        this->setData(std::vector<double>(aData.begin(), aData.end()));
+    }
+    virtual void getIntegerData(std::vector<int> & aData) const
+    {
+        std::vector<double> tData(aData.size());
+        this->getData(tData);
+        std::transform(tData.begin(), tData.end(), aData.begin(), [](double aValue) { return static_cast<int>(std::lround(aValue)); });
+    }
+    //! Values stored per global id of a field layout (1 for scalar fields)
+    virtual int numComponents() const { return 1; }
+
+    //! Direct view of the size() entries setData() writes; nullptr if the data has no contiguous storage
+    virtual double* getSendDataView() { return nullptr; }
+    //! Direct view of the size() entries getData() reads; nullptr if the data has no contiguous storage
+    virtual const double* getRecvDataView() const { return nullptr; }
+
+    //! Records a change to the data; call it on every rank that shares the data so the ranks agree on skipped transmits
+    virtual void markModified() {}
+    virtual int getNumTransmits() const { return 0; }
+    virtual int getNumSkippedTransmits() const { return 0; }
+
+    //! Writes this rank's values to a checkpoint; records are prefixed with myName()
+    virtual void writeCheckpoint(Plato::CheckpointWriter & aWriter) const {}
+    //! Restores values written by writeCheckpoint(); the next transmit is never skipped
+    virtual void readCheckpoint(const Plato::CheckpointReader & aReader) {}
 };
 
 } // End namespace Plato
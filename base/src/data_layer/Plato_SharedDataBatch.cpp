@@ -0,0 +1,263 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedDataBatch.cpp
+ *
+ */
+
+#include "Plato_SharedData.hpp"
+#include "Plato_SharedField.hpp"
+#include "Plato_SharedValue.hpp"
+#include "Plato_SharedDataBatch.hpp"
+#include "Plato_FieldTransmitPlan.hpp"
+#include "Plato_Tracer.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+SharedDataBatch::SharedDataBatch(const std::vector<Plato::SharedData*> & aSharedData) :
+        mFieldGroups(),
+        mValues(),
+        mUnbatched(),
+        mValueBuffer(),
+        mInterComm(MPI_COMM_NULL)
+/******************************************************************************/
+{
+    // Grouping only uses the communication pattern and the order of aSharedData,
+    // both of which are the same on every rank, so the exchanges line up.
+    //
+    for(Plato::SharedData* tSharedData : aSharedData)
+    {
+        Plato::SharedField* tField = dynamic_cast<Plato::SharedField*>(tSharedData);
+        // batches move full doubles through one blocking import, so encoded fields, and
+        // shared-memory fields, whose node-local receivers read the provider's window, go on their own
+        if(tField != nullptr && tField->myCommunicationPattern().empty() == false && tField->isNonblockingTransmit() == false
+           && tField->isSharedMemoryTransmit() == false
+           && tField->getTransmitEncoding() == Plato::communication::encoding_t::DOUBLE)
+        {
+            bool tFoundGroup = false;
+            for(FieldGroup & tGroup : mFieldGroups)
+            {
+                if(tGroup.mFields.front()->myCommunicationPattern() == tField->myCommunicationPattern())
+                {
+                    tGroup.mFields.push_back(tField);
+                    tFoundGroup = true;
+                    break;
+                }
+            }
+            if(tFoundGroup == false)
+            {
+                FieldGroup tNewGroup;
+                tNewGroup.mFields.push_back(tField);
+                mFieldGroups.push_back(tNewGroup);
+            }
+            continue;
+        }
+
+        Plato::SharedValue* tValue = dynamic_cast<Plato::SharedValue*>(tSharedData);
+        if(tValue != nullptr && tValue->isNonblockingTransmit() == false)
+        {
+            mValues.push_back(tValue);
+            continue;
+        }
+
+        mUnbatched.push_back(tSharedData);
+    }
+
+    // a field alone in its group keeps using its own plan
+    for(FieldGroup & tGroup : mFieldGroups)
+    {
+        const int tNumFields = tGroup.mFields.size();
+        if(tNumFields > 1)
+        {
+            tGroup.mPlan = tGroup.mFields.front()->createBatchPlan(tNumFields);
+            tGroup.mSendBuffer.resize(tNumFields * tGroup.mFields.front()->getNumProvidedValues());
+            tGroup.mRecvBuffer.resize(tNumFields * tGroup.mFields.front()->getNumReceivedValues());
+        }
+    }
+
+    int tBufferSize = 0;
+    for(Plato::SharedValue* tValue : mValues)
+    {
+        tBufferSize += tValue->size();
+    }
+    mValueBuffer.resize(tBufferSize);
+    if(mValues.empty() == false)
+    {
+        mInterComm = mValues.front()->getInterComm();
+    }
+}
+
+/******************************************************************************/
+SharedDataBatch::~SharedDataBatch()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+void SharedDataBatch::transmitData()
+/******************************************************************************/
+{
+    for(FieldGroup & tGroup : mFieldGroups)
+    {
+        this->transmitFields(tGroup);
+    }
+
+    this->transmitValues();
+
+    for(Plato::SharedData* tSharedData : mUnbatched)
+    {
+        tSharedData->transmitData();
+    }
+}
+
+/******************************************************************************/
+int SharedDataBatch::getNumUnbatched() const
+/******************************************************************************/
+{
+    return mUnbatched.size();
+}
+
+/******************************************************************************/
+void SharedDataBatch::transmitFields(FieldGroup & aGroup)
+/******************************************************************************/
+{
+    if(aGroup.mFields.size() == 1u)
+    {
+        aGroup.mFields.front()->transmitData();
+        return;
+    }
+
+    // the group moves as one, so it is skipped only if every field in it is current
+    bool tIsRedundant = true;
+    for(Plato::SharedField* tField : aGroup.mFields)
+    {
+        tIsRedundant = tIsRedundant && tField->isTransmitRedundant();
+    }
+    for(Plato::SharedField* tField : aGroup.mFields)
+    {
+        if(tIsRedundant)
+        {
+            tField->recordSkippedTransmit();
+        }
+        else
+        {
+            tField->recordTransmit();
+        }
+    }
+    if(tIsRedundant)
+    {
+        return;
+    }
+
+    Plato::TraceScope tTraceScope("transmit", "field batch");
+    tTraceScope.addBytes(sizeof(double) * (aGroup.mSendBuffer.size() + aGroup.mRecvBuffer.size()));
+
+    const int tNumFields = aGroup.mFields.size();
+    for(int tIndex = 0; tIndex < tNumFields; tIndex++)
+    {
+        aGroup.mFields[tIndex]->packSendData(aGroup.mSendBuffer, tIndex, tNumFields);
+    }
+
+    // the plan writes every received entry, zeroing only those nobody provides
+    aGroup.mPlan->post(aGroup.mSendBuffer.data(), aGroup.mRecvBuffer.data());
+    aGroup.mPlan->complete(aGroup.mRecvBuffer.data());
+
+    for(int tIndex = 0; tIndex < tNumFields; tIndex++)
+    {
+        aGroup.mFields[tIndex]->unpackRecvData(aGroup.mRecvBuffer, tIndex, tNumFields);
+    }
+}
+
+/******************************************************************************/
+void SharedDataBatch::transmitValues()
+/******************************************************************************/
+{
+    if(mValues.empty())
+    {
+        return;
+    }
+
+    bool tIsRedundant = true;
+    for(Plato::SharedValue* tValue : mValues)
+    {
+        tIsRedundant = tIsRedundant && tValue->isTransmitRedundant();
+    }
+    for(Plato::SharedValue* tValue : mValues)
+    {
+        if(tIsRedundant)
+        {
+            tValue->recordSkippedTransmit();
+        }
+        else
+        {
+            tValue->recordTransmit();
+        }
+    }
+    if(tIsRedundant)
+    {
+        return;
+    }
+
+    Plato::TraceScope tTraceScope("transmit", "value batch");
+    tTraceScope.addBytes(sizeof(double) * mValueBuffer.size());
+
+    double* tBuffer = mValueBuffer.data();
+    for(Plato::SharedValue* tValue : mValues)
+    {
+        tValue->packTransmitData(tBuffer);
+        tBuffer += tValue->size();
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, mValueBuffer.data(), mValueBuffer.size(), MPI_DOUBLE, MPI_SUM, mInterComm);
+
+    tBuffer = mValueBuffer.data();
+    for(Plato::SharedValue* tValue : mValues)
+    {
+        tValue->unpackTransmitData(tBuffer);
+        tBuffer += tValue->size();
+    }
+}
+
+} // End namespace Plato
@@ -0,0 +1,111 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedDataBatch.hpp
+ *
+ */
+
+#ifndef SRC_SHAREDDATABATCH_HPP_
+#define SRC_SHAREDDATABATCH_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "mpi.h"
+
+namespace Plato
+{
+
+class SharedData;
+class FieldTransmitPlan;
+class SharedField;
+class SharedValue;
+
+/******************************************************************************/
+//!  Transmits a list of SharedData in as few exchanges as possible
+/*!
+ SharedFields with the same communication pattern are packed side by side per
+ global id and moved with a single point-to-point plan.  All SharedValues are
+ packed into one buffer and moved with a single collective.  Anything else,
+ including data with nonblocking or shared-memory transmits, is transmitted
+ individually.
+ */
+/******************************************************************************/
+class SharedDataBatch
+{
+public:
+    explicit SharedDataBatch(const std::vector<Plato::SharedData*> & aSharedData);
+    ~SharedDataBatch();
+
+    void transmitData();
+
+    // number of shared data transmitted on their own
+    int getNumUnbatched() const;
+
+private:
+    struct FieldGroup
+    {
+        std::vector<Plato::SharedField*> mFields;
+        std::shared_ptr<Plato::FieldTransmitPlan> mPlan;
+        std::vector<double> mSendBuffer;
+        std::vector<double> mRecvBuffer;
+    };
+
+    void transmitFields(FieldGroup & aGroup);
+    void transmitValues();
+
+private:
+    std::vector<FieldGroup> mFieldGroups;
+    std::vector<Plato::SharedValue*> mValues;
+    std::vector<Plato::SharedData*> mUnbatched;
+    std::vector<double> mValueBuffer;
+    MPI_Comm mInterComm;
+
+private:
+    SharedDataBatch(const SharedDataBatch& aRhs);
+    SharedDataBatch& operator=(const SharedDataBatch& aRhs);
+};
+
+} // End namespace Plato
+
+#endif
@@ -56,6 +56,12 @@ namespace Plato
 /******************************************************************************/
 SharedDataInfo::SharedDataInfo() :
         mSharedDataSize(),
+        mNonblockingTransmit(),
+        mSharedMemoryTransmit(),
+        mSkipUnmodifiedTransmits(),
+        mTransmitEncoding(),
+        mNumComponents(),
+        mIntegerData(),
         mBroadcast(),
         mSharedDataIdentifiers(),
         mSharedDataMap()
@@ -116,6 +122,123 @@ void SharedDataInfo::setSharedDataSize(const std::string & aName, const int & aS
     mSharedDataSize[aName] = aSize;
 }
 
+/******************************************************************************/
+bool SharedDataInfo::isNonblockingTransmit(const std::string & aName) const
+/******************************************************************************/
+{
+    std::map<std::string, bool>::const_iterator tIterator;
+    tIterator = mNonblockingTransmit.find(aName);
+    if(tIterator == mNonblockingTransmit.end())
+    {
+        return (false);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setNonblockingTransmit(const std::string & aName, const bool & aNonblocking)
+/******************************************************************************/
+{
+    mNonblockingTransmit[aName] = aNonblocking;
+}
+
+/******************************************************************************/
+bool SharedDataInfo::isSharedMemoryTransmit(const std::string & aName) const
+/******************************************************************************/
+{
+    std::map<std::string, bool>::const_iterator tIterator;
+    tIterator = mSharedMemoryTransmit.find(aName);
+    if(tIterator == mSharedMemoryTransmit.end())
+    {
+        return (false);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setSharedMemoryTransmit(const std::string & aName, const bool & aSharedMemory)
+/******************************************************************************/
+{
+    mSharedMemoryTransmit[aName] = aSharedMemory;
+}
+
+/******************************************************************************/
+bool SharedDataInfo::isSkipUnmodifiedTransmits(const std::string & aName) const
+/******************************************************************************/
+{
+    std::map<std::string, bool>::const_iterator tIterator;
+    tIterator = mSkipUnmodifiedTransmits.find(aName);
+    if(tIterator == mSkipUnmodifiedTransmits.end())
+    {
+        return (false);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setSkipUnmodifiedTransmits(const std::string & aName, const bool & aSkip)
+/******************************************************************************/
+{
+    mSkipUnmodifiedTransmits[aName] = aSkip;
+}
+
+/******************************************************************************/
+Plato::communication::encoding_t SharedDataInfo::getTransmitEncoding(const std::string & aName) const
+/******************************************************************************/
+{
+    auto tIterator = mTransmitEncoding.find(aName);
+    if(tIterator == mTransmitEncoding.end())
+    {
+        return (Plato::communication::encoding_t::DOUBLE);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setTransmitEncoding(const std::string & aName, const Plato::communication::encoding_t & aEncoding)
+/******************************************************************************/
+{
+    mTransmitEncoding[aName] = aEncoding;
+}
+
+/******************************************************************************/
+int SharedDataInfo::getNumComponents(const std::string & aName) const
+/******************************************************************************/
+{
+    auto tIterator = mNumComponents.find(aName);
+    if(tIterator == mNumComponents.end())
+    {
+        return (1);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setNumComponents(const std::string & aName, const int & aNumComponents)
+/******************************************************************************/
+{
+    mNumComponents[aName] = aNumComponents;
+}
+
+/******************************************************************************/
+bool SharedDataInfo::isIntegerData(const std::string & aName) const
+/******************************************************************************/
+{
+    auto tIterator = mIntegerData.find(aName);
+    if(tIterator == mIntegerData.end())
+    {
+        return (false);
+    }
+    return (tIterator->second);
+}
+
+/******************************************************************************/
+void SharedDataInfo::setIntegerData(const std::string & aName, const bool & aInteger)
+/******************************************************************************/
+{
+    mIntegerData[aName] = aInteger;
+}
+
 /******************************************************************************/
 bool SharedDataInfo::isNameDefined(const std::string & aName) const
 /******************************************************************************/
@@ -64,6 +64,12 @@ struct communication
     {
         SENDER = 1, RECEIVER = 2, SENDER_AND_RECEIVER = 3, UNDEFINED = 4,
     };
+
+    //! how field values are put on the wire: as is, rounded to float, or losslessly compressed
+    enum encoding_t
+    {
+        DOUBLE = 0, FLOAT = 1, COMPRESSED = 2,
+    };
 };
 
 class SharedDataInfo
@@ -76,6 +82,19 @@ public:
     int getSharedDataSize(const std::string & aName) const;
     void setSharedDataSize(const std::string & aName, const int & aSize);
 
+    bool isNonblockingTransmit(const std::string & aName) const;
+    void setNonblockingTransmit(const std::string & aName, const bool & aNonblocking);
+    bool isSharedMemoryTransmit(const std::string & aName) const;
+    void setSharedMemoryTransmit(const std::string & aName, const bool & aSharedMemory);
+    bool isSkipUnmodifiedTransmits(const std::string & aName) const;
+    void setSkipUnmodifiedTransmits(const std::string & aName, const bool & aSkip);
+    Plato::communication::encoding_t getTransmitEncoding(const std::string & aName) const;
+    int getNumComponents(const std::string & aName) const;
+    void setNumComponents(const std::string & aName, const int & aNumComponents);
+    bool isIntegerData(const std::string & aName) const;
+    void setIntegerData(const std::string & aName, const bool & aInteger);
+    void setTransmitEncoding(const std::string & aName, const Plato::communication::encoding_t & aEncoding);
+
     const std::vector<std::string> & getProviderNames(const int & aIndex) const;
     const std::vector<std::string> & getReceiverNames(const int & aIndex) const;
     void setSharedDataMap(
@@ -93,6 +112,12 @@ public:
 
 private:
     std::map<std::string, int> mSharedDataSize;
+    std::map<std::string, bool> mNonblockingTransmit;
+    std::map<std::string, bool> mSharedMemoryTransmit;
+    std::map<std::string, bool> mSkipUnmodifiedTransmits;
+    std::map<std::string, Plato::communication::encoding_t> mTransmitEncoding;
+    std::map<std::string, int> mNumComponents;
+    std::map<std::string, bool> mIntegerData;
     std::vector<Plato::communication::broadcast_t> mBroadcast;
     std::vector<std::pair<std::string, std::string>> mSharedDataIdentifiers;
     std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>> mSharedDataMap;
@@ -47,7 +47,12 @@
  *
  */
 
+#include <algorithm>
+
 #include "Plato_SharedField.hpp"
+#include "Plato_FieldTransmitPlan.hpp"
+#include "Plato_Tracer.hpp"
+#include "Plato_Checkpoint.hpp"
 
 namespace Plato
 {
@@ -111,6 +116,13 @@ Plato::communication::broadcast_t SharedField::myBroadcast() const
     return mMyBroadcast;
 }
 
+/******************************************************************************/
+int SharedField::numComponents() const
+/******************************************************************************/
+{
+    return mNumComponents;
+}
+
 /******************************************************************************/
 void SharedField::setData(const std::vector<double> & aData)
 /******************************************************************************/
@@ -137,6 +149,8 @@ void SharedField::getData(std::vector<double>& aData) const
     assert(mRecvDataVector.get() != nullptr);
     assert(mMyBroadcast != Plato::communication::broadcast_t::UNDEFINED);
 
+    this->completeTransmit();
+
     int tMyLength = mRecvDataVector->MyLength();
     double* tMyDataView = nullptr;
     mRecvDataVector->ExtractView(&tMyDataView);
@@ -148,32 +162,72 @@ void SharedField::getData(std::vector<double>& aData) const
 }
 
 /******************************************************************************/
-void SharedField::setData(const double & aDataVal, const int & aGlobalIndex)
+double* SharedField::getSendDataView()
 /******************************************************************************/
 {
     assert(mSendDataVector.get() != nullptr);
+
+    // size() is the receive length on receivers, so only senders get a view
+    if(mMyBroadcast == Plato::communication::broadcast_t::RECEIVER)
+    {
+        return nullptr;
+    }
+
+    double* tMyDataView = nullptr;
+    mSendDataVector->ExtractView(&tMyDataView);
+    return tMyDataView;
+}
+
+/******************************************************************************/
+const double* SharedField::getRecvDataView() const
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+
+    // size() is the send length on senders, so only receivers get a view
+    if(mMyBroadcast == Plato::communication::broadcast_t::SENDER)
+    {
+        return nullptr;
+    }
+
+    this->completeTransmit();
+
+    double* tMyDataView = nullptr;
+    mRecvDataVector->ExtractView(&tMyDataView);
+    return tMyDataView;
+}
+
+/******************************************************************************/
+void SharedField::setData(const double & aDataVal, const int & aGlobalIndex, const int & aComponent)
+/******************************************************************************/
+{
+    assert(aComponent >= 0 && aComponent < mNumComponents);
+    assert(mSendDataVector.get() != nullptr);
     assert(mGlobalIDsProvided.get() != nullptr);
     assert(mMyBroadcast != Plato::communication::broadcast_t::UNDEFINED);
 
     int tLocalID = mGlobalIDsProvided->LID(aGlobalIndex);
     if(tLocalID >= 0)
     {
-        (*mSendDataVector)[tLocalID] = aDataVal;
+        (*mSendDataVector)[tLocalID * mNumComponents + aComponent] = aDataVal;
     }
 }
 
 /******************************************************************************/
-void SharedField::getData(double & aDataVal, const int & aGlobalIndex) const
+void SharedField::getData(double & aDataVal, const int & aGlobalIndex, const int & aComponent) const
 /******************************************************************************/
 {
+    assert(aComponent >= 0 && aComponent < mNumComponents);
     assert(mRecvDataVector.get() != nullptr);
     assert(mGlobalIDsReceived.get() != nullptr);
     assert(mMyBroadcast != Plato::communication::broadcast_t::UNDEFINED);
 
+    this->completeTransmit();
+
     int tLocalID = mGlobalIDsReceived->LID(aGlobalIndex);
     if(tLocalID >= 0)
     {
-        aDataVal = (*mRecvDataVector)[tLocalID];
+        aDataVal = (*mRecvDataVector)[tLocalID * mNumComponents + aComponent];
     }
 }
 
@@ -181,12 +235,286 @@ void SharedField::getData(double & aDataVal, const int & aGlobalIndex) const
 void SharedField::transmitData()
 /******************************************************************************/
 {
-    assert(mNodeImporter.get() != nullptr);
+    assert(mTransmitPlan.get() != nullptr);
     assert(mRecvDataVector.get() != nullptr);
     assert(mSendDataVector.get() != nullptr);
 
-    mRecvDataVector->PutScalar(0.0);
-    mRecvDataVector->Import(*mSendDataVector, *mNodeImporter, Insert);
+    if(this->isTransmitRedundant())
+    {
+        this->recordSkippedTransmit();
+        return;
+    }
+    this->recordTransmit();
+
+    Plato::TraceScope tTraceScope("transmit", mMyName);
+    tTraceScope.addBytes(sizeof(double) * (mSendDataVector->MyLength() + mRecvDataVector->MyLength()));
+
+    // finish the previous transfer before reusing the plan's buffers
+    this->completeTransmit();
+
+    double* tSendData = nullptr;
+    mSendDataVector->ExtractView(&tSendData);
+    double* tRecvData = nullptr;
+    mRecvDataVector->ExtractView(&tRecvData);
+    mTransmitPlan->post(tSendData, tRecvData);
+
+    if(mNonblockingTransmit == false)
+    {
+        this->completeTransmit();
+    }
+}
+
+/******************************************************************************/
+void SharedField::completeTransmit() const
+/******************************************************************************/
+{
+    if(mTransmitPlan->isPending())
+    {
+        Plato::TraceScope tTraceScope("transmit_wait", mMyName);
+        double* tRecvData = nullptr;
+        mRecvDataVector->ExtractView(&tRecvData);
+        mTransmitPlan->complete(tRecvData);
+    }
+}
+
+/******************************************************************************/
+void SharedField::setNonblockingTransmit(bool aNonblocking)
+/******************************************************************************/
+{
+    if(!aNonblocking)
+    {
+        this->completeTransmit();
+    }
+    mNonblockingTransmit = aNonblocking;
+}
+
+/******************************************************************************/
+void SharedField::setSharedMemoryTransmit(bool aSharedMemory)
+/******************************************************************************/
+{
+    // collective: the plan is rebuilt, and a shared-memory plan splits off a node
+    // communicator and allocates its window
+    if(aSharedMemory != mTransmitPlan->isSharedMemory())
+    {
+        this->completeTransmit();
+        std::shared_ptr<Plato::FieldTransmitPlan> tPlan =
+                std::make_shared<Plato::FieldTransmitPlan>(*mGlobalIDsProvided, *mGlobalIDsReceived, mEpetraComm->Comm(), aSharedMemory);
+        tPlan->setEncoding(mTransmitEncoding);
+
+        // with shared memory the provided values live in the plan's window segment, where
+        // node-local receivers read them; the values move over before the old plan goes away
+        double* tSendData = nullptr;
+        mSendDataVector->ExtractView(&tSendData);
+        if(aSharedMemory)
+        {
+            double* tSegment = tPlan->getSendSegment();
+            std::copy(tSendData, tSendData + mSendDataVector->MyLength(), tSegment);
+            mSendDataVector = std::make_shared<Epetra_Vector>(View, *mGlobalIDsProvided, tSegment);
+        }
+        else
+        {
+            mSendDataVector = std::make_shared<Epetra_Vector>(Copy, *mGlobalIDsProvided, tSendData);
+        }
+        mTransmitPlan = tPlan;
+    }
+}
+
+/******************************************************************************/
+void SharedField::setTransmitEncoding(Plato::communication::encoding_t aEncoding)
+/******************************************************************************/
+{
+    this->completeTransmit();
+    mTransmitEncoding = aEncoding;
+    mTransmitPlan->setEncoding(aEncoding);
+}
+
+/******************************************************************************/
+Plato::communication::encoding_t SharedField::getTransmitEncoding() const
+/******************************************************************************/
+{
+    return mTransmitEncoding;
+}
+
+/******************************************************************************/
+bool SharedField::isSharedMemoryTransmit() const
+/******************************************************************************/
+{
+    return mTransmitPlan->isSharedMemory();
+}
+
+/******************************************************************************/
+bool SharedField::isNonblockingTransmit() const
+/******************************************************************************/
+{
+    return mNonblockingTransmit;
+}
+
+/******************************************************************************/
+void SharedField::setSkipUnmodifiedTransmits(bool aSkip)
+/******************************************************************************/
+{
+    mSkipUnmodifiedTransmits = aSkip;
+}
+
+/******************************************************************************/
+void SharedField::markModified()
+/******************************************************************************/
+{
+    mVersion++;
+}
+
+/******************************************************************************/
+bool SharedField::isTransmitRedundant() const
+/******************************************************************************/
+{
+    return mSkipUnmodifiedTransmits && mVersion == mTransmittedVersion;
+}
+
+/******************************************************************************/
+void SharedField::recordTransmit()
+/******************************************************************************/
+{
+    mTransmittedVersion = mVersion;
+    mNumTransmits++;
+}
+
+/******************************************************************************/
+void SharedField::recordSkippedTransmit()
+/******************************************************************************/
+{
+    mNumSkippedTransmits++;
+}
+
+/******************************************************************************/
+int SharedField::getNumTransmits() const
+/******************************************************************************/
+{
+    return mNumTransmits;
+}
+
+/******************************************************************************/
+int SharedField::getNumSkippedTransmits() const
+/******************************************************************************/
+{
+    return mNumSkippedTransmits;
+}
+
+/******************************************************************************/
+void SharedField::writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+/******************************************************************************/
+{
+    this->completeTransmit();
+
+    double* tSendData = nullptr;
+    mSendDataVector->ExtractView(&tSendData);
+    aWriter.write(mMyName + "/send", tSendData, mSendDataVector->MyLength());
+
+    double* tRecvData = nullptr;
+    mRecvDataVector->ExtractView(&tRecvData);
+    aWriter.write(mMyName + "/recv", tRecvData, mRecvDataVector->MyLength());
+}
+
+/******************************************************************************/
+void SharedField::readCheckpoint(const Plato::CheckpointReader & aReader)
+/******************************************************************************/
+{
+    // drop any transfer in flight so it can't overwrite the restored values
+    this->completeTransmit();
+
+    double* tSendData = nullptr;
+    mSendDataVector->ExtractView(&tSendData);
+    aReader.read(mMyName + "/send", tSendData, mSendDataVector->MyLength());
+
+    double* tRecvData = nullptr;
+    mRecvDataVector->ExtractView(&tRecvData);
+    aReader.read(mMyName + "/recv", tRecvData, mRecvDataVector->MyLength());
+
+    this->markModified();
+}
+
+/******************************************************************************/
+const std::string & SharedField::myCommunicationPattern() const
+/******************************************************************************/
+{
+    return mMyCommunicationPattern;
+}
+
+/******************************************************************************/
+void SharedField::setCommunicationPattern(const std::string & aPattern)
+/******************************************************************************/
+{
+    // Fields that are given the same (non-empty) pattern must have identical
+    // provided and received maps on every rank.  An empty pattern means the
+    // field is always transmitted on its own.
+    mMyCommunicationPattern = aPattern;
+}
+
+/******************************************************************************/
+std::shared_ptr<Plato::FieldTransmitPlan> SharedField::createBatchPlan(int aNumFields) const
+/******************************************************************************/
+{
+    assert(mGlobalIDsProvided.get() != nullptr);
+    assert(mGlobalIDsReceived.get() != nullptr);
+
+    // same global ids, one entry of aNumFields * mNumComponents values each
+    const int tEntrySize = aNumFields * mNumComponents;
+    Epetra_BlockMap tProvidedMap(-1, mGlobalIDsProvided->NumMyElements(), mGlobalIDsProvided->MyGlobalElements(), tEntrySize, 0, *mEpetraComm);
+    Epetra_BlockMap tReceivedMap(-1, mGlobalIDsReceived->NumMyElements(), mGlobalIDsReceived->MyGlobalElements(), tEntrySize, 0, *mEpetraComm);
+    return std::make_shared<Plato::FieldTransmitPlan>(tProvidedMap, tReceivedMap, mEpetraComm->Comm());
+}
+
+/******************************************************************************/
+int SharedField::getNumProvidedValues() const
+/******************************************************************************/
+{
+    assert(mSendDataVector.get() != nullptr);
+    return mSendDataVector->MyLength();
+}
+
+/******************************************************************************/
+int SharedField::getNumReceivedValues() const
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+    return mRecvDataVector->MyLength();
+}
+
+/******************************************************************************/
+void SharedField::packSendData(std::vector<double> & aSendBuffer, int aField, int aNumFields) const
+/******************************************************************************/
+{
+    assert(mSendDataVector.get() != nullptr);
+    assert(static_cast<int>(aSendBuffer.size()) == aNumFields * mSendDataVector->MyLength());
+
+    const int tNumEntries = mGlobalIDsProvided->NumMyElements();
+    double* tFrom = nullptr;
+    mSendDataVector->ExtractView(&tFrom);
+    double* tTo = aSendBuffer.data() + aField * mNumComponents;
+    for(int tEntry = 0; tEntry < tNumEntries; tEntry++)
+    {
+        std::copy(tFrom, tFrom + mNumComponents, tTo);
+        tFrom += mNumComponents;
+        tTo += aNumFields * mNumComponents;
+    }
+}
+
+/******************************************************************************/
+void SharedField::unpackRecvData(const std::vector<double> & aRecvBuffer, int aField, int aNumFields)
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+    assert(static_cast<int>(aRecvBuffer.size()) == aNumFields * mRecvDataVector->MyLength());
+
+    const int tNumEntries = mGlobalIDsReceived->NumMyElements();
+    const double* tFrom = aRecvBuffer.data() + aField * mNumComponents;
+    double* tTo = nullptr;
+    mRecvDataVector->ExtractView(&tTo);
+    for(int tEntry = 0; tEntry < tNumEntries; tEntry++)
+    {
+        std::copy(tFrom, tFrom + mNumComponents, tTo);
+        tFrom += aNumFields * mNumComponents;
+        tTo += mNumComponents;
+    }
 }
 
 /******************************************************************************/
@@ -231,10 +559,11 @@ void SharedField::initialize(const Plato::CommunicationData & aCommData)
         }
     }
 
-    mGlobalIDsProvided = std::make_shared<Epetra_Map>(-1, tMySendGlobalIDs.size(), tMySendGlobalIDs.data(), 0, *mEpetraComm);
-    mGlobalIDsReceived = std::make_shared<Epetra_Map>(-1, tMyRecvGlobalIDs.size(), tMyRecvGlobalIDs.data(), 0, *mEpetraComm);
+    // one block of mNumComponents values per global id, so every component moves in one import
+    mGlobalIDsProvided = std::make_shared<Epetra_BlockMap>(-1, tMySendGlobalIDs.size(), tMySendGlobalIDs.data(), mNumComponents, 0, *mEpetraComm);
+    mGlobalIDsReceived = std::make_shared<Epetra_BlockMap>(-1, tMyRecvGlobalIDs.size(), tMyRecvGlobalIDs.data(), mNumComponents, 0, *mEpetraComm);
 
-    mNodeImporter = std::make_shared<Epetra_Import>(*mGlobalIDsReceived, *mGlobalIDsProvided);
+    mTransmitPlan = std::make_shared<Plato::FieldTransmitPlan>(*mGlobalIDsProvided, *mGlobalIDsReceived, mEpetraComm->Comm());
 
     mSendDataVector = std::make_shared<Epetra_Vector>(*mGlobalIDsProvided);
     mSendDataVector->PutScalar(0.0);
@@ -246,17 +575,27 @@ void SharedField::initialize(const Plato::CommunicationData & aCommData)
 SharedField::SharedField(const std::string & aMyName,
                          const Plato::communication::broadcast_t & aMyBroadcast,
                          const Plato::CommunicationData & aCommData,
-                         Plato::data::layout_t aMyLayout) :
+                         Plato::data::layout_t aMyLayout,
+                         int aNumComponents) :
         SharedData(),
         mMyName(aMyName),
         mMyLayout(aMyLayout),
         mMyBroadcast(aMyBroadcast),
+        mMyCommunicationPattern(),
+        mNumComponents(std::max(aNumComponents, 1)),
         mEpetraComm(std::make_shared<Epetra_MpiComm>(aCommData.mInterComm)),
         mGlobalIDsProvided(nullptr),
         mGlobalIDsReceived(nullptr),
-        mNodeImporter(nullptr),
         mSendDataVector(nullptr),
-        mRecvDataVector(nullptr)
+        mRecvDataVector(nullptr),
+        mTransmitPlan(nullptr),
+        mNonblockingTransmit(false),
+        mTransmitEncoding(Plato::communication::encoding_t::DOUBLE),
+        mSkipUnmodifiedTransmits(false),
+        mVersion(0),
+        mTransmittedVersion(-1),
+        mNumTransmits(0),
+        mNumSkippedTransmits(0)
 /*****************************************************************************/
 {
 #ifdef DEBUG_LOCATION
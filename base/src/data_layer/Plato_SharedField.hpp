@@ -56,7 +56,7 @@
 
 #include <Epetra_Vector.h>
 #include <Epetra_MpiComm.h>
-#include <Epetra_Map.h>
+#include <Epetra_BlockMap.h>
 #include <Epetra_Import.h>
 
 #include "Plato_SharedData.hpp"
@@ -68,6 +68,7 @@ namespace Plato
 
 struct communication;
 struct CommunicationData;
+class FieldTransmitPlan;
 
 class SharedField : public SharedData
 {
@@ -75,38 +76,92 @@ public:
     SharedField(const std::string & aMyName,
                 const Plato::communication::broadcast_t & aMyBroadcast,
                 const Plato::CommunicationData & aCommData,
-                Plato::data::layout_t aMyLayout);
+                Plato::data::layout_t aMyLayout,
+                int aNumComponents = 1);
     virtual ~SharedField();
 
     int size() const;
     std::string myName() const;
     Plato::data::layout_t myLayout() const;
     Plato::communication::broadcast_t myBroadcast() const;
+    int numComponents() const;
 
     void transmitData();
     void setData(const std::vector<double> & aData);
     void getData(std::vector<double> & aData) const;
-
-    void setData(const double & aDataVal, const int & aGlobalIndex);
-    void getData(double & dataVal, const int & aGlobalIndex) const;
+    double* getSendDataView();
+    const double* getRecvDataView() const;
+
+    // aComponent selects the component of the given global id in multi-component fields
+    void setData(const double & aDataVal, const int & aGlobalIndex, const int & aComponent = 0);
+    void getData(double & dataVal, const int & aGlobalIndex, const int & aComponent = 0) const;
+
+    // nonblocking transmits: posted by transmitData(), completed by the next read
+    void setNonblockingTransmit(bool aNonblocking);
+    bool isNonblockingTransmit() const;
+
+    // node-local transmits through an MPI-3 shared-memory window that stores the
+    // provided values; only the off-node part follows setNonblockingTransmit()
+    void setSharedMemoryTransmit(bool aSharedMemory);
+    bool isSharedMemoryTransmit() const;
+
+    // reduced-precision (FLOAT) or lossless compressed (COMPRESSED) transmits; the
+    // values are converted inside transmitData()
+    void setTransmitEncoding(Plato::communication::encoding_t aEncoding);
+    Plato::communication::encoding_t getTransmitEncoding() const;
+
+    // modification tracking: when enabled, transmitting data that hasn't been marked
+    // modified since its last transmit is a no-op
+    void setSkipUnmodifiedTransmits(bool aSkip);
+    void markModified();
+    bool isTransmitRedundant() const;
+    void recordTransmit();
+    void recordSkippedTransmit();
+    int getNumTransmits() const;
+    int getNumSkippedTransmits() const;
+
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const;
+    void readCheckpoint(const Plato::CheckpointReader & aReader);
+
+    // batched transmits: fields with the same communication pattern share one plan whose
+    // entries hold the values of all aNumFields fields for a global id, field after field
+    const std::string & myCommunicationPattern() const;
+    void setCommunicationPattern(const std::string & aPattern);
+    // collective over the field's communicator
+    std::shared_ptr<Plato::FieldTransmitPlan> createBatchPlan(int aNumFields) const;
+    int getNumProvidedValues() const;
+    int getNumReceivedValues() const;
+    void packSendData(std::vector<double> & aSendBuffer, int aField, int aNumFields) const;
+    void unpackRecvData(const std::vector<double> & aRecvBuffer, int aField, int aNumFields);
 
 private:
     void initialize(const Plato::CommunicationData & aCommData);
+    void completeTransmit() const;
 
 private:
     std::string mMyName;
     Plato::data::layout_t mMyLayout;
     Plato::communication::broadcast_t mMyBroadcast;
+    std::string mMyCommunicationPattern;
+    int mNumComponents;        /*!< values per global id, stored interleaved */
 
     std::shared_ptr<Epetra_MpiComm> mEpetraComm;
-    std::shared_ptr<Epetra_Map> mGlobalIDsProvided;
-    std::shared_ptr<Epetra_Map> mGlobalIDsReceived;
-
-    std::shared_ptr<Epetra_Import> mNodeImporter;
+    std::shared_ptr<Epetra_BlockMap> mGlobalIDsProvided;
+    std::shared_ptr<Epetra_BlockMap> mGlobalIDsReceived;
 
     std::shared_ptr<Epetra_Vector> mSendDataVector;
     std::shared_ptr<Epetra_Vector> mRecvDataVector;
 
+    std::shared_ptr<Plato::FieldTransmitPlan> mTransmitPlan;  /*!< persistent plan used by every transmit */
+    bool mNonblockingTransmit;
+    Plato::communication::encoding_t mTransmitEncoding;
+
+    bool mSkipUnmodifiedTransmits;
+    int mVersion;              /*!< bumped by markModified() */
+    int mTransmittedVersion;   /*!< version at the last transmit */
+    int mNumTransmits;
+    int mNumSkippedTransmits;
+
 private:
     SharedField(const SharedField& aRhs);
     SharedField& operator=(const SharedField& aRhs);
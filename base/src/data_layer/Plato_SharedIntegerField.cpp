@@ -0,0 +1,263 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedIntegerField.cpp
+ *
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "Plato_SharedIntegerField.hpp"
+#include "Plato_Tracer.hpp"
+#include "Plato_Checkpoint.hpp"
+
+namespace Plato
+{
+
+/*****************************************************************************/
+SharedIntegerField::SharedIntegerField(const std::string & aMyName,
+                                       const Plato::communication::broadcast_t & aMyBroadcast,
+                                       const Plato::CommunicationData & aCommData,
+                                       Plato::data::layout_t aMyLayout,
+                                       int aNumComponents) :
+        SharedData(),
+        mMyName(aMyName),
+        mMyLayout(aMyLayout),
+        mMyBroadcast(aMyBroadcast),
+        mNumComponents(std::max(aNumComponents, 1)),
+        mEpetraComm(std::make_shared<Epetra_MpiComm>(aCommData.mInterComm)),
+        mGlobalIDsProvided(nullptr),
+        mGlobalIDsReceived(nullptr),
+        mNodeImporter(nullptr),
+        mSendDataVector(nullptr),
+        mRecvDataVector(nullptr),
+        mSkipUnmodifiedTransmits(false),
+        mVersion(0),
+        mTransmittedVersion(-1),
+        mNumTransmits(0),
+        mNumSkippedTransmits(0)
+/*****************************************************************************/
+{
+    this->initialize(aCommData);
+}
+
+/*****************************************************************************/
+SharedIntegerField::~SharedIntegerField()
+/*****************************************************************************/
+{
+}
+
+/******************************************************************************/
+void SharedIntegerField::initialize(const Plato::CommunicationData & aCommData)
+/******************************************************************************/
+{
+    const std::vector<int> & tOwnedGIDs = aCommData.mMyOwnedGlobalIDs.at(mMyLayout);
+    const bool tIsSender = mMyBroadcast == Plato::communication::broadcast_t::SENDER
+                        || mMyBroadcast == Plato::communication::broadcast_t::SENDER_AND_RECEIVER;
+    const bool tIsReceiver = mMyBroadcast == Plato::communication::broadcast_t::RECEIVER
+                          || mMyBroadcast == Plato::communication::broadcast_t::SENDER_AND_RECEIVER;
+    std::vector<int> tMySendGlobalIDs = tIsSender ? tOwnedGIDs : std::vector<int>();
+    std::vector<int> tMyRecvGlobalIDs = tIsReceiver ? tOwnedGIDs : std::vector<int>();
+
+    mGlobalIDsProvided = std::make_shared<Epetra_BlockMap>(-1, tMySendGlobalIDs.size(), tMySendGlobalIDs.data(), mNumComponents, 0, *mEpetraComm);
+    mGlobalIDsReceived = std::make_shared<Epetra_BlockMap>(-1, tMyRecvGlobalIDs.size(), tMyRecvGlobalIDs.data(), mNumComponents, 0, *mEpetraComm);
+
+    mNodeImporter = std::make_shared<Epetra_Import>(*mGlobalIDsReceived, *mGlobalIDsProvided);
+
+    mSendDataVector = std::make_shared<Epetra_IntVector>(*mGlobalIDsProvided);
+    mRecvDataVector = std::make_shared<Epetra_IntVector>(*mGlobalIDsReceived);
+}
+
+/******************************************************************************/
+int SharedIntegerField::size() const
+/******************************************************************************/
+{
+    // same convention as SharedField: the receive length unless this rank only sends
+    if(mMyBroadcast == Plato::communication::broadcast_t::SENDER)
+    {
+        return mSendDataVector->MyLength();
+    }
+    return mRecvDataVector->MyLength();
+}
+
+/******************************************************************************/
+std::string SharedIntegerField::myName() const
+/******************************************************************************/
+{
+    return mMyName;
+}
+
+/******************************************************************************/
+Plato::data::layout_t SharedIntegerField::myLayout() const
+/******************************************************************************/
+{
+    return mMyLayout;
+}
+
+/******************************************************************************/
+Plato::communication::broadcast_t SharedIntegerField::myBroadcast() const
+/******************************************************************************/
+{
+    return mMyBroadcast;
+}
+
+/******************************************************************************/
+int SharedIntegerField::numComponents() const
+/******************************************************************************/
+{
+    return mNumComponents;
+}
+
+/******************************************************************************/
+void SharedIntegerField::transmitData()
+/******************************************************************************/
+{
+    if(mSkipUnmodifiedTransmits && mVersion == mTransmittedVersion)
+    {
+        mNumSkippedTransmits++;
+        return;
+    }
+    mTransmittedVersion = mVersion;
+    mNumTransmits++;
+
+    Plato::TraceScope tTraceScope("transmit", mMyName);
+    tTraceScope.addBytes(sizeof(int) * (mSendDataVector->MyLength() + mRecvDataVector->MyLength()));
+
+    mRecvDataVector->PutValue(0);
+    mRecvDataVector->Import(*mSendDataVector, *mNodeImporter, Insert);
+}
+
+/******************************************************************************/
+void SharedIntegerField::setIntegerData(const std::vector<int> & aData)
+/******************************************************************************/
+{
+    const int tMyLength = mSendDataVector->MyLength();
+    std::copy(aData.begin(), aData.begin() + tMyLength, mSendDataVector->Values());
+}
+
+/******************************************************************************/
+void SharedIntegerField::getIntegerData(std::vector<int> & aData) const
+/******************************************************************************/
+{
+    const int tMyLength = mRecvDataVector->MyLength();
+    const int* tValues = mRecvDataVector->Values();
+    std::copy(tValues, tValues + tMyLength, aData.begin());
+}
+
+/******************************************************************************/
+void SharedIntegerField::setData(const std::vector<double> & aData)
+/******************************************************************************/
+{
+    const int tMyLength = mSendDataVector->MyLength();
+    int* tValues = mSendDataVector->Values();
+    for(int tIndex = 0; tIndex < tMyLength; tIndex++)
+    {
+        tValues[tIndex] = static_cast<int>(std::lround(aData[tIndex]));
+    }
+}
+
+/******************************************************************************/
+void SharedIntegerField::getData(std::vector<double> & aData) const
+/******************************************************************************/
+{
+    const int tMyLength = mRecvDataVector->MyLength();
+    const int* tValues = mRecvDataVector->Values();
+    std::copy(tValues, tValues + tMyLength, aData.begin());
+}
+
+/******************************************************************************/
+void SharedIntegerField::setSkipUnmodifiedTransmits(bool aSkip)
+/******************************************************************************/
+{
+    mSkipUnmodifiedTransmits = aSkip;
+}
+
+/******************************************************************************/
+void SharedIntegerField::markModified()
+/******************************************************************************/
+{
+    mVersion++;
+}
+
+/******************************************************************************/
+int SharedIntegerField::getNumTransmits() const
+/******************************************************************************/
+{
+    return mNumTransmits;
+}
+
+/******************************************************************************/
+int SharedIntegerField::getNumSkippedTransmits() const
+/******************************************************************************/
+{
+    return mNumSkippedTransmits;
+}
+
+/******************************************************************************/
+void SharedIntegerField::writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+/******************************************************************************/
+{
+    // checkpoint records hold doubles, which represent every int exactly
+    const int* tSendValues = mSendDataVector->Values();
+    aWriter.write(mMyName + "/send", std::vector<double>(tSendValues, tSendValues + mSendDataVector->MyLength()));
+    const int* tRecvValues = mRecvDataVector->Values();
+    aWriter.write(mMyName + "/recv", std::vector<double>(tRecvValues, tRecvValues + mRecvDataVector->MyLength()));
+}
+
+/******************************************************************************/
+void SharedIntegerField::readCheckpoint(const Plato::CheckpointReader & aReader)
+/******************************************************************************/
+{
+    std::vector<double> tData(mSendDataVector->MyLength());
+    aReader.read(mMyName + "/send", tData.data(), tData.size());
+    std::transform(tData.begin(), tData.end(), mSendDataVector->Values(), [](double aValue) { return static_cast<int>(aValue); });
+
+    tData.resize(mRecvDataVector->MyLength());
+    aReader.read(mMyName + "/recv", tData.data(), tData.size());
+    std::transform(tData.begin(), tData.end(), mRecvDataVector->Values(), [](double aValue) { return static_cast<int>(aValue); });
+
+    this->markModified();
+}
+
+} // End namespace Plato
@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedIntegerField.hpp
+ *
+ */
+
+#ifndef SRC_SHAREDINTEGERFIELD_HPP_
+#define SRC_SHAREDINTEGERFIELD_HPP_
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <Epetra_IntVector.h>
+#include <Epetra_MpiComm.h>
+#include <Epetra_BlockMap.h>
+#include <Epetra_Import.h>
+
+#include "Plato_SharedData.hpp"
+#include "Plato_Communication.hpp"
+#include "Plato_SharedDataInfo.hpp"
+
+namespace Plato
+{
+
+struct CommunicationData;
+
+//!  Integer-valued field (element block ids, material indices, ...)
+/*!
+ Same maps and broadcast semantics as SharedField, but the values are stored
+ and moved as ints, with aNumComponents interleaved values per global id.
+ The double interface converts.  Transmits are blocking Epetra imports.
+ */
+class SharedIntegerField : public SharedData
+{
+public:
+    SharedIntegerField(const std::string & aMyName,
+                       const Plato::communication::broadcast_t & aMyBroadcast,
+                       const Plato::CommunicationData & aCommData,
+                       Plato::data::layout_t aMyLayout,
+                       int aNumComponents = 1);
+    virtual ~SharedIntegerField();
+
+    int size() const;
+    std::string myName() const;
+    Plato::data::layout_t myLayout() const;
+    Plato::communication::broadcast_t myBroadcast() const;
+    int numComponents() const;
+
+    void transmitData();
+    void setData(const std::vector<double> & aData);
+    void getData(std::vector<double> & aData) const;
+    void setIntegerData(const std::vector<int> & aData);
+    void getIntegerData(std::vector<int> & aData) const;
+
+    // modification tracking: when enabled, transmitting data that hasn't been marked
+    // modified since its last transmit is a no-op
+    void setSkipUnmodifiedTransmits(bool aSkip);
+    void markModified();
+    int getNumTransmits() const;
+    int getNumSkippedTransmits() const;
+
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const;
+    void readCheckpoint(const Plato::CheckpointReader & aReader);
+
+private:
+    void initialize(const Plato::CommunicationData & aCommData);
+
+private:
+    std::string mMyName;
+    Plato::data::layout_t mMyLayout;
+    Plato::communication::broadcast_t mMyBroadcast;
+    int mNumComponents;
+
+    std::shared_ptr<Epetra_MpiComm> mEpetraComm;
+    std::shared_ptr<Epetra_BlockMap> mGlobalIDsProvided;
+    std::shared_ptr<Epetra_BlockMap> mGlobalIDsReceived;
+    std::shared_ptr<Epetra_Import> mNodeImporter;
+
+    std::shared_ptr<Epetra_IntVector> mSendDataVector;
+    std::shared_ptr<Epetra_IntVector> mRecvDataVector;
+
+    bool mSkipUnmodifiedTransmits;
+    int mVersion;
+    int mTransmittedVersion;
+    int mNumTransmits;
+    int mNumSkippedTransmits;
+
+private:
+    SharedIntegerField(const SharedIntegerField& aRhs);
+    SharedIntegerField& operator=(const SharedIntegerField& aRhs);
+};
+
+} // End namespace Plato
+
+#endif
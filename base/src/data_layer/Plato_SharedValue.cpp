@@ -47,11 +47,15 @@
  *
  */
 
+#include <algorithm>
+
 #include "Plato_Parser.hpp"
 #include "Plato_SharedData.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_SharedValue.hpp"
 #include "Plato_Communication.hpp"
+#include "Plato_Tracer.hpp"
+#include "Plato_Checkpoint.hpp"
 
 namespace Plato
 {
@@ -60,76 +64,231 @@ namespace Plato
 void SharedValue::transmitData()
 /******************************************************************************/
 {
-    int tMyProcID = -1;
-    MPI_Comm_rank(mMyComm, &tMyProcID);
+    if( this->isTransmitRedundant() )
+    {
+        this->recordSkippedTransmit();
+        return;
+    }
+    this->recordTransmit();
+
+    Plato::TraceScope tTraceScope("transmit", mMyName);
+    tTraceScope.addBytes(sizeof(double) * mNumData);
+
+    if( mTransmitComm != MPI_COMM_NULL )
+    {
+        // finish the previous transfer before reusing the transmit buffer
+        this->completeTransmit();
+    }
+
+    if( mIsProviderRoot )
+    {
+        std::copy(mData.begin(), mData.end(), mTransmitBuffer.begin());
+    }
 
     if( mProviderNames.size() == 1 )
-    { // single provider
-        int tGlobalProcID = -1;
-        bool tIsProvider = mLocalCommName == mProviderNames[0];
-        if(tMyProcID == 0 && tIsProvider)
+    { // single provider: broadcast from rank zero of the provider's local comm
+        if( mTransmitComm != MPI_COMM_NULL )
         {
-            MPI_Comm_rank(mInterComm, &tGlobalProcID);
+            MPI_Ibcast(mTransmitBuffer.data(), mNumData, MPI_DOUBLE, mSenderProcID, mTransmitComm, &mTransmitRequest);
+            mIsTransmitPending = true;
+            return;
         }
-        int tSenderProcID = -1;
-        MPI_Allreduce(&tGlobalProcID, &tSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
-        auto tRecv(mData);
-        MPI_Bcast(tRecv.data(), tRecv.size(), MPI_DOUBLE, tSenderProcID, mInterComm);
-        if( !tIsProvider ){
-            mData = tRecv;
+        MPI_Bcast(mTransmitBuffer.data(), mNumData, MPI_DOUBLE, mSenderProcID, mInterComm);
+    }
+    else
+    { // multiple providers: sum the data from rank zero of each provider's local comm
+        if( !mIsProviderRoot )
+        {
+            std::fill(mTransmitBuffer.begin(), mTransmitBuffer.end(), 0.0);
         }
+        if( mTransmitComm != MPI_COMM_NULL )
+        {
+            MPI_Iallreduce(MPI_IN_PLACE, mTransmitBuffer.data(), mNumData, MPI_DOUBLE, MPI_SUM, mTransmitComm, &mTransmitRequest);
+            mIsTransmitPending = true;
+            return;
+        }
+        MPI_Allreduce(MPI_IN_PLACE, mTransmitBuffer.data(), mNumData, MPI_DOUBLE, MPI_SUM, mInterComm);
     }
-    else 
-    { // multiple provider
-    
-        // reduce data from all rank zeros of all provider local comms.
-        //
-
-        // determine if local rank is a provider
-        bool tIsaProvider = 
-         ( std::find( mProviderNames.begin(), 
-                      mProviderNames.end(), 
-                      mLocalCommName ) != mProviderNames.end() );
-        int tProviderColor = (tMyProcID == 0 && tIsaProvider) ? 1 : 0;
-    
-        // create temporary comm for reducing from multiple providers
-        int tGlobalProcID = -1;
-        MPI_Comm_rank(mInterComm, &tGlobalProcID);
-        MPI_Comm tReductionComm;
-        MPI_Comm_split(mInterComm, tProviderColor, tGlobalProcID, &tReductionComm);
 
-        // reduce data to rank zero of tReductionComm
-        std::vector<double> tRecv(mData.size(), 0.0);
-        MPI_Reduce(mData.data(), tRecv.data(), mData.size(), MPI_DOUBLE, MPI_SUM, /*rank_of_root=*/0, tReductionComm);
+    if( !mIsProvider )
+    {
+        std::copy(mTransmitBuffer.begin(), mTransmitBuffer.end(), mData.begin());
+    }
+}
+
+/******************************************************************************/
+void SharedValue::completeTransmit() const
+/******************************************************************************/
+{
+    if( mIsTransmitPending )
+    {
+        Plato::TraceScope tTraceScope("transmit_wait", mMyName);
+        MPI_Wait(&mTransmitRequest, MPI_STATUS_IGNORE);
+        mIsTransmitPending = false;
+        if( !mIsProvider )
+        {
+            std::copy(mTransmitBuffer.begin(), mTransmitBuffer.end(), mData.begin());
+        }
+    }
+}
+
+/******************************************************************************/
+void SharedValue::setNonblockingTransmit(bool aNonblocking)
+/******************************************************************************/
+{
+    // collective: nonblocking collectives get their own communicator so they
+    // can't interleave with blocking collectives on the inter-comm
+    if( aNonblocking && mTransmitComm == MPI_COMM_NULL )
+    {
+        MPI_Comm_dup(mInterComm, &mTransmitComm);
+    }
+    else if( !aNonblocking && mTransmitComm != MPI_COMM_NULL )
+    {
+        this->completeTransmit();
+        MPI_Comm_free(&mTransmitComm);
+    }
+}
+
+/******************************************************************************/
+bool SharedValue::isNonblockingTransmit() const
+/******************************************************************************/
+{
+    return mTransmitComm != MPI_COMM_NULL;
+}
+
+/******************************************************************************/
+void SharedValue::setSkipUnmodifiedTransmits(bool aSkip)
+/******************************************************************************/
+{
+    mSkipUnmodifiedTransmits = aSkip;
+}
+
+/******************************************************************************/
+void SharedValue::writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+/******************************************************************************/
+{
+    this->completeTransmit();
+    aWriter.write(mMyName, mData);
+}
+
+/******************************************************************************/
+void SharedValue::readCheckpoint(const Plato::CheckpointReader & aReader)
+/******************************************************************************/
+{
+    this->completeTransmit();
+    aReader.read(mMyName, mData.data(), mData.size());
+    this->markModified();
+}
+
+/******************************************************************************/
+void SharedValue::markModified()
+/******************************************************************************/
+{
+    mVersion++;
+}
+
+/******************************************************************************/
+bool SharedValue::isTransmitRedundant() const
+/******************************************************************************/
+{
+    return mSkipUnmodifiedTransmits && mVersion == mTransmittedVersion;
+}
 
+/******************************************************************************/
+void SharedValue::recordTransmit()
+/******************************************************************************/
+{
+    mTransmittedVersion = mVersion;
+    mNumTransmits++;
+}
 
-        // broadcast the result to all ranks in mIntercomm
-        //
+/******************************************************************************/
+void SharedValue::recordSkippedTransmit()
+/******************************************************************************/
+{
+    mNumSkippedTransmits++;
+}
+
+/******************************************************************************/
+int SharedValue::getNumTransmits() const
+/******************************************************************************/
+{
+    return mNumTransmits;
+}
+
+/******************************************************************************/
+int SharedValue::getNumSkippedTransmits() const
+/******************************************************************************/
+{
+    return mNumSkippedTransmits;
+}
+
+/******************************************************************************/
+MPI_Comm SharedValue::getInterComm() const
+/******************************************************************************/
+{
+    return mInterComm;
+}
+
+/******************************************************************************/
+void SharedValue::packTransmitData(double* aBuffer) const
+/******************************************************************************/
+{
+    // Only provider roots contribute, so a sum over all ranks of the packed
+    // buffers reproduces transmitData() for one provider or many.
+    if( mIsProviderRoot )
+    {
+        std::copy(mData.begin(), mData.end(), aBuffer);
+    }
+    else
+    {
+        std::fill(aBuffer, aBuffer + mNumData, 0.0);
+    }
+}
 
-        // get rank in mReductionComm
-        int tRankInReductionComm;
-        MPI_Comm_rank(tReductionComm, &tRankInReductionComm);
+/******************************************************************************/
+void SharedValue::unpackTransmitData(const double* aBuffer)
+/******************************************************************************/
+{
+    if( !mIsProvider )
+    {
+        std::copy(aBuffer, aBuffer + mNumData, mData.begin());
+    }
+}
 
-        // if the local rank is not zero (i.e., the sender), then flip the global rank to -1
-        if( tRankInReductionComm ) tGlobalProcID = -1;
+/******************************************************************************/
+void SharedValue::initialize()
+/******************************************************************************/
+{
+    // The communication pattern only depends on who provides the value, so
+    // it is resolved here once instead of on every transmit.
+    //
+    int tMyProcID = -1;
+    MPI_Comm_rank(mMyComm, &tMyProcID);
 
-        // global max now returns the rank of the sender
-        int tSenderProcID=-1;
-        MPI_Allreduce(&tGlobalProcID, &tSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
+    mIsProvider = ( std::find( mProviderNames.begin(),
+                               mProviderNames.end(),
+                               mLocalCommName ) != mProviderNames.end() );
+    mIsProviderRoot = mIsProvider && (tMyProcID == 0);
 
-        // broadcast the reduced data to all ranks 
-        MPI_Bcast(tRecv.data(), tRecv.size(), MPI_DOUBLE, tSenderProcID, mInterComm);
-        if( !tIsaProvider ){
-            mData = tRecv;
+    if( mProviderNames.size() == 1 )
+    {
+        int tGlobalProcID = -1;
+        if( mIsProviderRoot )
+        {
+            MPI_Comm_rank(mInterComm, &tGlobalProcID);
         }
+        MPI_Allreduce(&tGlobalProcID, &mSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
     }
 }
-  
 
 /******************************************************************************/
 void SharedValue::setData(const std::vector<double> & aData)
 /******************************************************************************/
 {
+    // a pending receive must land before it is overwritten
+    this->completeTransmit();
+
     for(int tIndex = 0; tIndex < mNumData; tIndex++)
     {
         mData[tIndex] = aData[tIndex];
@@ -140,12 +299,31 @@ void SharedValue::setData(const std::vector<double> & aData)
 void SharedValue::getData(std::vector<double> & aData) const
 /******************************************************************************/
 {
+    this->completeTransmit();
+
     for(int tIndex = 0; tIndex < mNumData; tIndex++)
     {
         aData[tIndex] = mData[tIndex];
     }
 }
 
+/******************************************************************************/
+double* SharedValue::getSendDataView()
+/******************************************************************************/
+{
+    // a pending receive must land before the caller writes over it
+    this->completeTransmit();
+    return mData.data();
+}
+
+/******************************************************************************/
+const double* SharedValue::getRecvDataView() const
+/******************************************************************************/
+{
+    this->completeTransmit();
+    return mData.data();
+}
+
 /*****************************************************************************/
 int SharedValue::size() const
 /*****************************************************************************/
@@ -178,15 +356,35 @@ SharedValue::SharedValue(const std::string & aMyName,
         mInterComm(aCommData.mInterComm),
         mNumData(aSize),
         mData(std::vector<double>(aSize)),
-        mMyLayout(Plato::data::layout_t::SCALAR)
+        mMyLayout(Plato::data::layout_t::SCALAR),
+        mIsProvider(false),
+        mIsProviderRoot(false),
+        mSenderProcID(-1),
+        mTransmitBuffer(std::vector<double>(aSize)),
+        mTransmitComm(MPI_COMM_NULL),
+        mTransmitRequest(MPI_REQUEST_NULL),
+        mIsTransmitPending(false),
+        mSkipUnmodifiedTransmits(false),
+        mVersion(0),
+        mTransmittedVersion(-1),
+        mNumTransmits(0),
+        mNumSkippedTransmits(0)
 /*****************************************************************************/
 {
+    this->initialize();
 }
 
 /*****************************************************************************/
 SharedValue::~SharedValue()
 /*****************************************************************************/
 {
+    int tIsFinalized = 0;
+    MPI_Finalized(&tIsFinalized);
+    if( tIsFinalized == 0 && mTransmitComm != MPI_COMM_NULL )
+    {
+        this->completeTransmit();
+        MPI_Comm_free(&mTransmitComm);
+    }
 }
 
 } // End namespace Plato
@@ -76,6 +76,34 @@ public:
     void transmitData();
     void setData(const std::vector<double> & aData);
     void getData(std::vector<double> & aData) const;
+    double* getSendDataView();
+    const double* getRecvDataView() const;
+
+    // nonblocking transmits: posted by transmitData(), completed by the next read
+    void setNonblockingTransmit(bool aNonblocking);
+    bool isNonblockingTransmit() const;
+
+    // modification tracking: when enabled, transmitting data that hasn't been marked
+    // modified since its last transmit is a no-op
+    void setSkipUnmodifiedTransmits(bool aSkip);
+    void markModified();
+    bool isTransmitRedundant() const;
+    void recordTransmit();
+    void recordSkippedTransmit();
+    int getNumTransmits() const;
+    int getNumSkippedTransmits() const;
+
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const;
+    void readCheckpoint(const Plato::CheckpointReader & aReader);
+
+    // batched transmits: values are summed into a buffer shared with other values
+    MPI_Comm getInterComm() const;
+    void packTransmitData(double* aBuffer) const;
+    void unpackTransmitData(const double* aBuffer);
+
+private:
+    void initialize();
+    void completeTransmit() const;
 
 private:
     std::string mMyName;
@@ -86,9 +114,24 @@ private:
     MPI_Comm mInterComm;
 
     int mNumData;
-    std::vector<double> mData;
+    mutable std::vector<double> mData;
     Plato::data::layout_t mMyLayout;
 
+    bool mIsProvider;          /*!< local performer is one of the providers */
+    bool mIsProviderRoot;      /*!< rank zero of a provider's local comm */
+    int mSenderProcID;         /*!< global rank that broadcasts (single provider only) */
+    std::vector<double> mTransmitBuffer;
+
+    MPI_Comm mTransmitComm;                /*!< private comm for nonblocking transmits */
+    mutable MPI_Request mTransmitRequest;
+    mutable bool mIsTransmitPending;
+
+    bool mSkipUnmodifiedTransmits;
+    int mVersion;              /*!< bumped by markModified() */
+    int mTransmittedVersion;   /*!< version at the last transmit */
+    int mNumTransmits;
+    int mNumSkippedTransmits;
+
 private:
     SharedValue(const SharedValue& aRhs);
     SharedValue& operator=(const SharedValue& aRhs);
@@ -0,0 +1,243 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_TransmitEncoding.cpp
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "Plato_TransmitEncoding.hpp"
+
+namespace Plato
+{
+
+namespace
+{
+
+const size_t cMaxRun = 128;
+
+/******************************************************************************/
+size_t pack_bits(const unsigned char* aInput, size_t aLength, unsigned char* aOutput)
+/******************************************************************************/
+{
+    // header h < 128: h+1 literal bytes follow; h > 128: the next byte repeats 257-h times
+    size_t tOut = 0;
+    size_t tIndex = 0;
+    while(tIndex < aLength)
+    {
+        size_t tRun = 1;
+        while(tIndex + tRun < aLength && tRun < cMaxRun && aInput[tIndex + tRun] == aInput[tIndex])
+        {
+            tRun++;
+        }
+        if(tRun >= 3)
+        {
+            aOutput[tOut++] = static_cast<unsigned char>(257 - tRun);
+            aOutput[tOut++] = aInput[tIndex];
+            tIndex += tRun;
+            continue;
+        }
+
+        const size_t tBegin = tIndex;
+        while(tIndex < aLength && tIndex - tBegin < cMaxRun)
+        {
+            if(tIndex + 2 < aLength && aInput[tIndex] == aInput[tIndex + 1] && aInput[tIndex] == aInput[tIndex + 2])
+            {
+                break;
+            }
+            tIndex++;
+        }
+        const size_t tNumLiterals = tIndex - tBegin;
+        aOutput[tOut++] = static_cast<unsigned char>(tNumLiterals - 1);
+        std::memcpy(aOutput + tOut, aInput + tBegin, tNumLiterals);
+        tOut += tNumLiterals;
+    }
+    return tOut;
+}
+
+/******************************************************************************/
+void unpack_bits(const unsigned char* aInput, size_t aNumBytes, size_t aLength, unsigned char* aOutput)
+/******************************************************************************/
+{
+    size_t tOut = 0;
+    size_t tIndex = 0;
+    while(tOut < aLength && tIndex < aNumBytes)
+    {
+        const unsigned char tHeader = aInput[tIndex++];
+        if(tHeader < 128)
+        {
+            const size_t tCount = std::min<size_t>({tHeader + 1u, aLength - tOut, aNumBytes - tIndex});
+            std::memcpy(aOutput + tOut, aInput + tIndex, tCount);
+            tOut += tCount;
+            tIndex += tHeader + 1u;
+        }
+        else if(tHeader > 128 && tIndex < aNumBytes)
+        {
+            const size_t tCount = std::min<size_t>(257u - tHeader, aLength - tOut);
+            std::fill(aOutput + tOut, aOutput + tOut + tCount, aInput[tIndex++]);
+            tOut += tCount;
+        }
+    }
+    std::fill(aOutput + tOut, aOutput + aLength, 0);
+}
+
+}
+
+/******************************************************************************/
+TransmitEncoding::TransmitEncoding(Plato::communication::encoding_t aEncoding) :
+        mEncoding(aEncoding),
+        mScratch()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+Plato::communication::encoding_t TransmitEncoding::type() const
+/******************************************************************************/
+{
+    return mEncoding;
+}
+
+/******************************************************************************/
+size_t TransmitEncoding::capacity(size_t aLength) const
+/******************************************************************************/
+{
+    switch(mEncoding)
+    {
+        case Plato::communication::encoding_t::FLOAT:
+            return aLength * sizeof(float);
+        case Plato::communication::encoding_t::COMPRESSED:
+        {
+            const size_t tNumBytes = aLength * sizeof(double);
+            return tNumBytes + (tNumBytes + cMaxRun - 1) / cMaxRun;
+        }
+        default:
+            return aLength * sizeof(double);
+    }
+}
+
+/******************************************************************************/
+size_t TransmitEncoding::encode(const double* aValues, size_t aLength, unsigned char* aOutput)
+/******************************************************************************/
+{
+    switch(mEncoding)
+    {
+        case Plato::communication::encoding_t::FLOAT:
+        {
+            for(size_t tIndex = 0; tIndex < aLength; tIndex++)
+            {
+                const float tValue = static_cast<float>(aValues[tIndex]);
+                std::memcpy(aOutput + tIndex * sizeof(float), &tValue, sizeof(float));
+            }
+            return aLength * sizeof(float);
+        }
+        case Plato::communication::encoding_t::COMPRESSED:
+        {
+            mScratch.resize(aLength * sizeof(double));
+            uint64_t tPrevious = 0;
+            for(size_t tIndex = 0; tIndex < aLength; tIndex++)
+            {
+                uint64_t tBits = 0;
+                std::memcpy(&tBits, aValues + tIndex, sizeof(double));
+                const uint64_t tDelta = tBits ^ tPrevious;
+                tPrevious = tBits;
+                for(size_t tByte = 0; tByte < sizeof(double); tByte++)
+                {
+                    mScratch[tByte * aLength + tIndex] = static_cast<unsigned char>(tDelta >> (8 * tByte));
+                }
+            }
+            return pack_bits(mScratch.data(), mScratch.size(), aOutput);
+        }
+        default:
+        {
+            std::memcpy(aOutput, aValues, aLength * sizeof(double));
+            return aLength * sizeof(double);
+        }
+    }
+}
+
+/******************************************************************************/
+void TransmitEncoding::decode(const unsigned char* aInput, size_t aNumBytes, size_t aLength, double* aValues)
+/******************************************************************************/
+{
+    switch(mEncoding)
+    {
+        case Plato::communication::encoding_t::FLOAT:
+        {
+            for(size_t tIndex = 0; tIndex < aLength; tIndex++)
+            {
+                float tValue = 0;
+                std::memcpy(&tValue, aInput + tIndex * sizeof(float), sizeof(float));
+                aValues[tIndex] = tValue;
+            }
+            break;
+        }
+        case Plato::communication::encoding_t::COMPRESSED:
+        {
+            mScratch.resize(aLength * sizeof(double));
+            unpack_bits(aInput, aNumBytes, mScratch.size(), mScratch.data());
+            uint64_t tPrevious = 0;
+            for(size_t tIndex = 0; tIndex < aLength; tIndex++)
+            {
+                uint64_t tDelta = 0;
+                for(size_t tByte = 0; tByte < sizeof(double); tByte++)
+                {
+                    tDelta |= static_cast<uint64_t>(mScratch[tByte * aLength + tIndex]) << (8 * tByte);
+                }
+                tPrevious ^= tDelta;
+                std::memcpy(aValues + tIndex, &tPrevious, sizeof(double));
+            }
+            break;
+        }
+        default:
+        {
+            std::memcpy(aValues, aInput, aLength * sizeof(double));
+            break;
+        }
+    }
+}
+
+} // End namespace Plato
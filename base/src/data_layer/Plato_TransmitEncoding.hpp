@@ -0,0 +1,90 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_TransmitEncoding.hpp
+ *
+ */
+
+#ifndef SRC_TRANSMITENCODING_HPP_
+#define SRC_TRANSMITENCODING_HPP_
+
+#include <vector>
+#include <cstddef>
+
+#include "Plato_SharedDataInfo.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+//!  Wire format of the field values a FieldTransmitPlan sends
+/*!
+ DOUBLE copies the values.  FLOAT rounds them to single precision, which halves
+ the message size.  COMPRESSED is lossless: each value is XORed with the one
+ before it, the bytes are shuffled so that byte k of every value is contiguous,
+ and the shuffled bytes are run-length encoded (PackBits).  Smooth, constant or
+ mostly-zero fields shrink well; random data grows by at most 1/128.
+ */
+/******************************************************************************/
+class TransmitEncoding
+{
+public:
+    explicit TransmitEncoding(Plato::communication::encoding_t aEncoding = Plato::communication::encoding_t::DOUBLE);
+
+    Plato::communication::encoding_t type() const;
+
+    //! largest number of bytes encode() writes for aLength values
+    size_t capacity(size_t aLength) const;
+    //! encodes aLength values into aOutput and returns the number of bytes written
+    size_t encode(const double* aValues, size_t aLength, unsigned char* aOutput);
+    //! decodes aLength values from the aNumBytes bytes at aInput
+    void decode(const unsigned char* aInput, size_t aNumBytes, size_t aLength, double* aValues);
+
+private:
+    Plato::communication::encoding_t mEncoding;
+    std::vector<unsigned char> mScratch;
+};
+
+} // End namespace Plato
+
+#endif
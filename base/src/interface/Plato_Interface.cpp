@@ -48,6 +48,7 @@
  */
 
 #include <limits>
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <cstdlib>
@@ -65,6 +66,8 @@
 #include "Plato_Parser.hpp"
 #include "Plato_SharedDataInfo.hpp"
 #include "Plato_StageInputDataMng.hpp"
+#include "Plato_Tracer.hpp"
+#include "Plato_Checkpoint.hpp"
 
 namespace Plato
 {
@@ -81,7 +84,12 @@ Interface::Interface(MPI_Comm aGlobalComm) :
         mInputData("Input Data"),
         mLocalComm(),
         mGlobalComm(aGlobalComm),
-        mIsDone(false)
+        mIsDone(false),
+        mCheckpointFileName("plato_checkpoint"),
+        mCheckpointTag(0),
+        mOptimizerCheckpointTags(),
+        mReadOptimizerCheckpoint(),
+        mNumStageComputes(0)
 /******************************************************************************/
 {
     // get the local program's communicator id from the environment.
@@ -96,8 +104,9 @@ Interface::Interface(MPI_Comm aGlobalComm) :
         // throw
     }
 
+    // rank 0 reads the interface file and broadcasts it; every rank parses from memory.
     const char* input_char = getenv("PLATO_INTERFACE_FILE");
-    Plato::Parser* parser = new Plato::PugiParser();
+    Plato::Parser* parser = new Plato::PugiParser(mGlobalComm);
     mInputData = parser->parseFile(input_char);
     delete parser;
 
@@ -116,7 +125,12 @@ Interface::Interface(const int & aCommID, const std::string & aXML_String, MPI_C
         mInputData("Input Data"),
         mLocalComm(),
         mGlobalComm(aGlobalComm),
-        mIsDone(false)
+        mIsDone(false),
+        mCheckpointFileName("plato_checkpoint"),
+        mCheckpointTag(0),
+        mOptimizerCheckpointTags(),
+        mReadOptimizerCheckpoint(),
+        mNumStageComputes(0)
 /******************************************************************************/
 {
     // get the local program's communicator id.
@@ -127,8 +141,9 @@ Interface::Interface(const int & aCommID, const std::string & aXML_String, MPI_C
     // throw
 
     const char* input_char = getenv("PLATO_INTERFACE_FILE");
-    Plato::Parser* parser = new Plato::PugiParser();
+    Plato::Parser* parser = new Plato::PugiParser(mGlobalComm);
     mInputData = parser->parseFile(input_char);
+    delete parser;
 
     this->createPerformers();
 }
@@ -189,17 +204,20 @@ Interface::getStage(std::string aStageName)
     else
         tStageIndex = getStageIndex(aStageName);
 
+    return this->getStage(tStageIndex);
+}
+
+/******************************************************************************/
+Plato::Stage*
+Interface::getStage(int aStageIndex)
+/******************************************************************************/
+{
+    // broadcast the index of the next stage
+    int tStageIndex = aStageIndex;
+
     broadcastStageIndex(tStageIndex);
 
-    if(tStageIndex >= 0)
-    {
-        return mStages[tStageIndex];
-    }
-    else
-    {
-        mIsDone = true;
-        return nullptr;
-    }
+    return this->selectStage(tStageIndex);
 }
 
 /******************************************************************************/
@@ -213,17 +231,201 @@ Interface::getStage()
 
     broadcastStageIndex(tStageIndex);
 
-    if(tStageIndex >= 0)
+    return this->selectStage(tStageIndex);
+}
+
+/******************************************************************************/
+Plato::Stage*
+Interface::selectStage(int aStageIndex)
+/******************************************************************************/
+{
+    if(aStageIndex >= 0)
+    {
+        if(mStageRecorder.isEnabled())
+        {
+            std::vector<std::string> tTransmits;
+            for(Plato::SharedData* tSharedData : mStages[aStageIndex]->getTransmitSequence())
+            {
+                tTransmits.push_back(tSharedData->myName());
+            }
+            mStageRecorder.recordStage(mStages[aStageIndex]->getName(), tTransmits);
+        }
+        return mStages[aStageIndex];
+    }
+    else if(aStageIndex == CHECKPOINT_STAGE || aStageIndex == RESTART_STAGE)
     {
-        return mStages[tStageIndex];
+        this->checkpointSharedData(aStageIndex);
+        return nullptr;
     }
     else
     {
+        // every rank receives the terminate stage, so the trace is written here
+        Plato::Tracer::get().finalize();
+        mStageRecorder.finalize();
         mIsDone = true;
         return nullptr;
     }
 }
 
+/******************************************************************************/
+void Interface::checkpointSharedData(int aStageIndex)
+/******************************************************************************/
+{
+    if(aStageIndex == CHECKPOINT_STAGE)
+    {
+        this->writeSharedDataCheckpoint();
+    }
+    else
+    {
+        this->readSharedDataCheckpoint();
+    }
+    // every rank gets here, so a missing or bad file on one rank stops all of them
+    this->handleExceptions();
+}
+
+/******************************************************************************/
+void Interface::writeSharedDataCheckpoint()
+/******************************************************************************/
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(mGlobalComm, &tMyRank);
+    const int tNextTag = mCheckpointTag + 1;
+    int tIsWritten = 0;
+    try
+    {
+        const int tSlot = Plato::checkpoint_slot(tNextTag);
+        Plato::CheckpointWriter tWriter(Plato::checkpoint_file_name(mCheckpointFileName, tSlot, tMyRank));
+        tWriter.write("checkpoint/tag", static_cast<double>(tNextTag));
+        mDataLayer->writeCheckpoint(tWriter);
+        tWriter.close();
+        if(tNextTag == 1)
+        {
+            // the other slot can only hold a checkpoint of an earlier run
+            const int tOtherSlot = Plato::checkpoint_slot(tNextTag + 1);
+            std::remove(Plato::checkpoint_file_name(mCheckpointFileName, tOtherSlot, tMyRank).c_str());
+        }
+        tIsWritten = 1;
+    }
+    catch(...)
+    {
+        mExceptionHandler->Catch();
+    }
+
+    // a failed write leaves the previous checkpoint in place, so the count only moves once
+    // every rank has written this one
+    int tIsWrittenEverywhere = 0;
+    MPI_Allreduce(&tIsWritten, &tIsWrittenEverywhere, 1, MPI_INT, MPI_MIN, mGlobalComm);
+    if(tIsWrittenEverywhere == 1)
+    {
+        mCheckpointTag = tNextTag;
+    }
+}
+
+/******************************************************************************/
+void Interface::readSharedDataCheckpoint()
+/******************************************************************************/
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(mGlobalComm, &tMyRank);
+
+    // a slot is usable on this rank if its file reads back whole, its tag belongs in the slot,
+    // and the optimizer's file in the same slot (on optimizer ranks) has the same tag. Files
+    // that don't read are expected after a crash, so they only rule their slot out.
+    std::vector<std::shared_ptr<Plato::CheckpointReader>> tReaders(Plato::cNumCheckpointSlots);
+    std::vector<int> tSlotTags(Plato::cNumCheckpointSlots, -1);
+    for(int tSlot = 0; tSlot < Plato::cNumCheckpointSlots; tSlot++)
+    {
+        try
+        {
+            tReaders[tSlot] = std::make_shared<Plato::CheckpointReader>(Plato::checkpoint_file_name(mCheckpointFileName, tSlot, tMyRank));
+            const int tTag = tReaders[tSlot]->read("checkpoint/tag");
+            const bool tOptimizerMatches = mOptimizerCheckpointTags.empty() || mOptimizerCheckpointTags[tSlot] == tTag;
+            if(tTag > 0 && Plato::checkpoint_slot(tTag) == tSlot && tOptimizerMatches)
+            {
+                tSlotTags[tSlot] = tTag;
+            }
+        }
+        catch(...)
+        {
+            tReaders[tSlot].reset();
+        }
+    }
+
+    std::vector<int> tMinTags(Plato::cNumCheckpointSlots, -1);
+    std::vector<int> tMaxTags(Plato::cNumCheckpointSlots, -1);
+    MPI_Allreduce(tSlotTags.data(), tMinTags.data(), Plato::cNumCheckpointSlots, MPI_INT, MPI_MIN, mGlobalComm);
+    MPI_Allreduce(tSlotTags.data(), tMaxTags.data(), Plato::cNumCheckpointSlots, MPI_INT, MPI_MAX, mGlobalComm);
+    int tNewestSlot = -1;
+    for(int tSlot = 0; tSlot < Plato::cNumCheckpointSlots; tSlot++)
+    {
+        const bool tIsComplete = tMinTags[tSlot] > 0 && tMinTags[tSlot] == tMaxTags[tSlot];
+        if(tIsComplete && (tNewestSlot < 0 || tMinTags[tSlot] > tMinTags[tNewestSlot]))
+        {
+            tNewestSlot = tSlot;
+        }
+    }
+
+    if(tNewestSlot < 0)
+    {
+        std::stringstream tMsg;
+        tMsg << "No complete checkpoint '" << mCheckpointFileName << "' found: neither slot holds the same tag "
+             << "in every rank's shared data and optimizer files.";
+        this->registerException(Plato::ParsingException(tMsg.str()));
+    }
+    else
+    {
+        try
+        {
+            mDataLayer->readCheckpoint(*tReaders[tNewestSlot]);
+            if(mReadOptimizerCheckpoint)
+            {
+                mReadOptimizerCheckpoint(tNewestSlot);
+            }
+            mCheckpointTag = tMinTags[tNewestSlot];
+        }
+        catch(...)
+        {
+            mExceptionHandler->Catch();
+        }
+    }
+    mOptimizerCheckpointTags.clear();
+    mReadOptimizerCheckpoint = nullptr;
+}
+
+/******************************************************************************/
+void Interface::writeCheckpoint()
+/******************************************************************************/
+{
+    int tStageIndex = CHECKPOINT_STAGE;
+    this->broadcastStageIndex(tStageIndex);
+    this->selectStage(tStageIndex);
+}
+
+/******************************************************************************/
+void Interface::readCheckpoint(const std::vector<int> & aOptimizerTags, const std::function<void(int aSlot)> & aReadOptimizer)
+/******************************************************************************/
+{
+    mOptimizerCheckpointTags = aOptimizerTags;
+    mReadOptimizerCheckpoint = aReadOptimizer;
+    int tStageIndex = RESTART_STAGE;
+    this->broadcastStageIndex(tStageIndex);
+    this->selectStage(tStageIndex);
+}
+
+/******************************************************************************/
+int Interface::getCheckpointTag() const
+/******************************************************************************/
+{
+    return mCheckpointTag;
+}
+
+/******************************************************************************/
+const std::string & Interface::getCheckpointFileName() const
+/******************************************************************************/
+{
+    return mCheckpointFileName;
+}
+
 /******************************************************************************/
 void Interface::perform()
 /******************************************************************************/
@@ -253,20 +455,118 @@ void Interface::perform()
 void Interface::perform(Plato::Stage* aStage)
 /******************************************************************************/
 {
+    Plato::TraceScope tTraceScope("stage", aStage->getName());
+    mRankBalance.beginStage();
+
     // transmits input data
     //
     aStage->begin();
 
-    // any local operations?
+    // Operations in a level are independent, so each performer works through its
+    // own operations in the level without synchronizing with the other performers.
+    // Ranks only synchronize at level boundaries, where the level's shared data is
+    // transmitted and, by default, exceptions are checked.
     //
-    Plato::Operation* tOperation = aStage->getNextOperation();
-    while(tOperation)
+    const std::string tExceptionCheck = aStage->getExceptionCheck();
+    const bool tCheckEachArgument = (tExceptionCheck == "ARGUMENT");
+    const bool tCheckEachOperation = (tExceptionCheck == "OPERATION");
+    const bool tCheckEachLevel = (tExceptionCheck == "LEVEL");
+
+    bool tHasLocalError = false;
+    const int tNumLevels = aStage->getNumOperationLevels();
+    for(int tLevelIndex = 0; tLevelIndex < tNumLevels; tLevelIndex++)
     {
+        aStage->beginOperationLevel(tLevelIndex);
 
-        tOperation->sendInput();
+        if(tCheckEachArgument)
+        {
+            this->performAndCheck(aStage->getOperationLevel(tLevelIndex));
+        }
+        else
+        {
+            // a rank that already failed skips the remaining local work; it still
+            // takes part in the level transmits so collectives stay matched.
+            for(Plato::Operation* tOperation : aStage->getOperationLevel(tLevelIndex))
+            {
+                if(tHasLocalError == false && tOperation->hasLocalPerformer())
+                {
+                    try
+                    {
+                        this->perform(tOperation);
+                    }
+                    catch(...)
+                    {
+                        mExceptionHandler->Catch();
+                        tHasLocalError = true;
+                    }
+                }
+
+                // every rank joins the check, including ranks without this operation
+                if(tCheckEachOperation)
+                {
+                    mExceptionHandler->handleExceptions();
+                }
+            }
+        }
+
+        if(tCheckEachLevel)
+        {
+            mExceptionHandler->handleExceptions();
+        }
+
+        aStage->endOperationLevel(tLevelIndex);
+    }
+
+    if(tExceptionCheck == "STAGE")
+    {
+        mExceptionHandler->handleExceptions();
+    }
+
+    // transmits output data
+    //
+    aStage->end();
+
+    mRankBalance.endStage(aStage->getName());
+}
+
+/******************************************************************************/
+void Interface::perform(Plato::Operation* aOperation)
+/******************************************************************************/
+{
+    Plato::TraceScope tTraceScope("operation", aOperation->getOperationName());
+    mRankBalance.beginBusy();
+
+    // copy data from Plato::SharedData buffers to hostedCode data containers
+    //
+    aOperation->importInputData();
+
+    const double tComputeBegin = MPI_Wtime();
+    aOperation->compute();
+    if(aOperation->hasLocalPerformer())
+    {
+        mStageRecorder.recordCompute(aOperation->getOperationName(), MPI_Wtime() - tComputeBegin);
+    }
+
+    // copy data from hostedCode data containers to Plato::SharedData buffers
+    //
+    aOperation->exportOutputData();
+
+    mRankBalance.endBusy();
+}
+
+/******************************************************************************/
+void Interface::performAndCheck(const std::vector<Plato::Operation*> & aOperations)
+/******************************************************************************/
+{
+    // Debugging mode: every rank walks every operation in the level and checks for
+    // exceptions after each import, compute, and export, so a failure is reported
+    // at the argument that caused it.  Operations without a local performer are
+    // no-ops, but the ranks still join each check.
+    //
+    for(Plato::Operation* tOperation : aOperations)
+    {
+        Plato::TraceScope tTraceScope("operation", tOperation->getOperationName());
 
-        // copy data from Plato::SharedData buffers to hostedCode data containers
-        //
         std::vector<std::string> tOperationInputDataNames = tOperation->getInputDataNames();
         for(std::string tName : tOperationInputDataNames)
         {
@@ -291,8 +591,6 @@ void Interface::perform(Plato::Stage* aStage)
         }
         mExceptionHandler->handleExceptions();
 
-        // copy data from hostedCode data containers to Plato::SharedData buffers
-        //
         std::vector<std::string> tOperationOutputDataNames = tOperation->getOutputDataNames();
         for(std::string tName : tOperationOutputDataNames)
         {
@@ -306,15 +604,7 @@ void Interface::perform(Plato::Stage* aStage)
             }
             mExceptionHandler->handleExceptions();
         }
-
-        tOperation->sendOutput();
-
-        tOperation = aStage->getNextOperation();
     }
-
-    // transmits output data
-    //
-    aStage->end();
 }
 
 /******************************************************************************/
@@ -331,26 +621,104 @@ void Interface::compute(const std::vector<std::string> & aStageNames, Teuchos::P
 void Interface::compute(const std::string & aStageName, Teuchos::ParameterList& aArguments)
 /******************************************************************************/
 {
+    // an unknown name is broadcast as an invalid stage, so every rank reports the error
+    int tStageIndex = getStageIndex(aStageName);
+    if(aStageName == "Terminate")
+        tStageIndex = TERMINATE_STAGE;
+    else if(tStageIndex < 0)
+        tStageIndex = INVALID_STAGE;
+
+    this->compute(tStageIndex, aArguments);
+}
+
+/******************************************************************************/
+void Interface::compute(const std::vector<int> & aStageHandles, Teuchos::ParameterList& aArguments)
+/******************************************************************************/
+{
+    for(int tStageHandle : aStageHandles)
+    {
+        this->compute(tStageHandle, aArguments);
+    }
+}
+
+/******************************************************************************/
+void Interface::compute(int aStageHandle, Teuchos::ParameterList& aArguments)
+/******************************************************************************/
+{
+    // the optimizer's own work between stages counts as busy time of its ranks
+    mRankBalance.endBusy();
+    mStageRecorder.recordDriver();
+
+    // an invalid handle is broadcast as an invalid stage, so every rank throws
+    int tStageHandle = aStageHandle;
+    const bool tIsStageIndex = aStageHandle >= 0 && aStageHandle < static_cast<int>(mStages.size());
+    if(tIsStageIndex == false && aStageHandle != TERMINATE_STAGE && aStageHandle != INVALID_STAGE)
+    {
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: Interface::compute: Invalid stage handle (" << aStageHandle << ").\n\n";
+        this->registerException(Plato::ParsingException(tMsg.str()));
+        tStageHandle = INVALID_STAGE;
+    }
+
     // find requested stage
-    Plato::Stage* tStage = getStage(aStageName);
+    Plato::Stage* tStage = getStage(tStageHandle);
+    if(tStage == nullptr)
+    {
+        return;
+    }
 
-    // Unpack input arguments into Plato::SharedData
+    // Unpack input arguments into Plato::SharedData.  The stage holds the shared
+    // data pointers, so the data layer isn't searched by name.
     //
-    std::vector<std::string> tStageInputDataNames = tStage->getInputDataNames();
-    for(std::string tName : tStageInputDataNames)
+    for(Plato::SharedData* tSharedData : tStage->getInputData())
     {
-        exportData(aArguments.get<double*>(tName), mDataLayer->getSharedData(tName));
+        exportData(aArguments.get<double*>(tSharedData->myName()), tSharedData);
     }
 
     this->perform(tStage);
+    mNumStageComputes++;
 
     // Unpack output arguments from Plato::SharedData
     //
-    std::vector<std::string> tStageOutputDataNames = tStage->getOutputDataNames();
-    for(std::string tName : tStageOutputDataNames)
+    for(Plato::SharedData* tSharedData : tStage->getOutputData())
+    {
+        importData(aArguments.get<double*>(tSharedData->myName()), tSharedData);
+    }
+
+    mRankBalance.beginBusy();
+}
+
+/******************************************************************************/
+size_t Interface::getNumStageComputes() const
+/******************************************************************************/
+{
+    return mNumStageComputes;
+}
+
+/******************************************************************************/
+int Interface::bindStage(const std::string & aStageName) const
+/******************************************************************************/
+{
+    if(aStageName == "Terminate")
+    {
+        return TERMINATE_STAGE;
+    }
+
+    const int tStageIndex = getStageIndex(aStageName);
+    if(tStageIndex < 0)
     {
-        importData(aArguments.get<double*>(tName), mDataLayer->getSharedData(tName));
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: Interface::bindStage: Stage '" << aStageName << "' doesn't exist.\n\n";
+        throw Plato::ParsingException(tMsg.str());
     }
+    return tStageIndex;
+}
+
+/******************************************************************************/
+int Interface::bindSharedData(const std::string & aSharedDataName) const
+/******************************************************************************/
+{
+    return mDataLayer->getSharedDataIndex(aSharedDataName);
 }
 
 /******************************************************************************/
@@ -358,16 +726,68 @@ void Interface::exportData(double* aFrom, Plato::SharedData* aTo)
 /******************************************************************************/
 {
     int tMyLength = aTo->size();
+
+    // write straight into the shared data's send buffer when it exposes one
+    double* tSendData = aTo->getSendDataView();
+    if(tSendData != nullptr)
+    {
+        if(tSendData != aFrom)
+        {
+            std::copy(aFrom, aFrom + tMyLength, tSendData);
+        }
+        return;
+    }
+
     std::vector<double> tExportData(tMyLength);
     std::copy(aFrom, aFrom + tMyLength, tExportData.begin());
     aTo->setData(tExportData);
 }
 
+/******************************************************************************/
+void Interface::exportData(double* aFrom, int aSharedDataHandle)
+/******************************************************************************/
+{
+    this->exportData(aFrom, mDataLayer->getSharedData(aSharedDataHandle));
+}
+
+/******************************************************************************/
+void Interface::importData(double* aTo, int aSharedDataHandle)
+/******************************************************************************/
+{
+    this->importData(aTo, mDataLayer->getSharedData(aSharedDataHandle));
+}
+
+/******************************************************************************/
+double* Interface::getSendDataView(const std::string & aName, int aLength)
+/******************************************************************************/
+{
+    for(Plato::SharedData* tSharedData : mDataLayer->getSharedData())
+    {
+        if(tSharedData->myName() == aName)
+        {
+            return tSharedData->size() == aLength ? tSharedData->getSendDataView() : nullptr;
+        }
+    }
+    return nullptr;
+}
+
 /******************************************************************************/
 void Interface::importData(double* aTo, Plato::SharedData* aFrom)
 /******************************************************************************/
 {
     int tMyLength = aFrom->size();
+
+    // read straight out of the shared data's receive buffer when it exposes one
+    const double* tRecvData = aFrom->getRecvDataView();
+    if(tRecvData != nullptr)
+    {
+        if(tRecvData != aTo)
+        {
+            std::copy(tRecvData, tRecvData + tMyLength, aTo);
+        }
+        return;
+    }
+
     std::vector<double> tImportData(tMyLength);
     aFrom->getData(tImportData);
     std::copy(tImportData.begin(), tImportData.end(), aTo);
@@ -516,6 +936,7 @@ void Interface::createPerformers()
     MPI_Allgather(&mPerformerID, 1, MPI_INT, tPerformerIDs.data(), 1, MPI_INT, mGlobalComm);
 
     int tCommIndex = 0;
+    int tMyNumComms = 1;
     for( auto tNode : mInputData.getByName<Plato::InputData>("Performer") )
     {
         int tLocalPerformerID = Plato::Get::Int(tNode, "PerformerID");
@@ -523,6 +944,10 @@ void Interface::createPerformers()
         auto tPerformerNames = tNode.getByName<std::string>("Name");
         int tNumCommsThisID = tPerformerNames.size();
         int tLocalPerformerCommSize = tNumRanksThisID / tNumCommsThisID;
+        if( tLocalPerformerID == mPerformerID )
+        {
+            tMyNumComms = tNumCommsThisID;
+        }
 
         // Does the number of Comms partition the ranks for this PerformerID without a remainder?
         //
@@ -581,6 +1006,51 @@ void Interface::createPerformers()
     mPerformer = std::make_shared<Plato::Performer>(mLocalPerformerName, mLocalCommID);
 
     mExceptionHandler = new Plato::ExceptionHandler(mLocalPerformerName, mLocalComm, mGlobalComm);
+
+    // optional trace of stages, operations, and transmits; written when the run terminates
+    if( mInputData.size<Plato::InputData>("Trace") )
+    {
+        Plato::InputData tTraceNode = mInputData.get<Plato::InputData>("Trace");
+        if( Plato::Get::Bool(tTraceNode, "Enabled") )
+        {
+            std::string tFileName = Plato::Get::String(tTraceNode, "FileName", std::string("plato_trace"));
+            Plato::Tracer::get().enable(mGlobalComm, tFileName, mPerformerID, mLocalPerformerName);
+        }
+    }
+
+    // base name of the per-rank checkpoint files written and read by the optimizer's
+    // checkpoint and restart requests
+    if( mInputData.size<Plato::InputData>("Checkpoint") )
+    {
+        Plato::InputData tCheckpointNode = mInputData.get<Plato::InputData>("Checkpoint");
+        mCheckpointFileName = Plato::Get::String(tCheckpointNode, "FileName", std::string("plato_checkpoint"));
+    }
+
+    // optional measurement of each performer's busy time over the first iterations, reported
+    // with a recommended split of the ranks between the PerformerIDs
+    if( mInputData.size<Plato::InputData>("RankBalance") )
+    {
+        Plato::InputData tBalanceNode = mInputData.get<Plato::InputData>("RankBalance");
+        if( Plato::Get::Bool(tBalanceNode, "Enabled") )
+        {
+            int tNumIterations = Plato::Get::Int(tBalanceNode, "Iterations", 10);
+            std::string tIterationStage = Plato::Get::String(tBalanceNode, "IterationStage");
+            std::string tFileName = Plato::Get::String(tBalanceNode, "FileName", std::string("plato_rank_balance.txt"));
+            mRankBalance.enable(mGlobalComm, mPerformerID, tMyNumComms, tNumIterations, tIterationStage, tFileName);
+        }
+    }
+
+    // optional recording of the stage traffic (stages, transmits, field sizes, and compute times)
+    // that the PlatoReplay executable plays back without the hosted codes
+    if( mInputData.size<Plato::InputData>("Record") )
+    {
+        Plato::InputData tRecordNode = mInputData.get<Plato::InputData>("Record");
+        if( Plato::Get::Bool(tRecordNode, "Enabled") )
+        {
+            std::string tFileName = Plato::Get::String(tRecordNode, "FileName", std::string("plato_stage_recording.txt"));
+            mStageRecorder.enable(mGlobalComm, mLocalPerformerName, tFileName);
+        }
+    }
 }
 
 /******************************************************************************/
@@ -614,10 +1084,74 @@ void Interface::createSharedData(Plato::Application* aApplication)
         Parse::toUppercase(tMyLayout);
         tSharedDataInfo.setSharedDataSize(tMyName, tMySize);
         tSharedDataInfo.setSharedDataIdentifiers(tMyName, tMyLayout);
+
+        // post transmits without waiting; receivers complete them on first read
+        bool tMyNonblocking = Plato::Get::Bool(tNode, "NonblockingTransmit");
+        tSharedDataInfo.setNonblockingTransmit(tMyName, tMyNonblocking);
+
+        // node-local field transfers read the provider's values from shared memory
+        bool tMySharedMemory = Plato::Get::Bool(tNode, "SharedMemoryTransmit");
+        tSharedDataInfo.setSharedMemoryTransmit(tMyName, tMySharedMemory);
+
+        // skip transmits when no stage has written the data since the last one.  Only
+        // writes through stage inputs and operation outputs count, so data written any
+        // other way must leave this off.
+        bool tMySkipUnmodified = Plato::Get::Bool(tNode, "SkipUnmodifiedTransmits");
+        tSharedDataInfo.setSkipUnmodifiedTransmits(tMyName, tMySkipUnmodified);
+
+        // multi-component fields store their components interleaved per global id and move them in one import
+        int tMyNumComponents = Plato::Get::Int(tNode, "Components", 1);
+        if(tMyNumComponents < 1)
+        {
+            std::stringstream tMsg;
+            tMsg << "Plato::Interface: SharedData ('" << tMyName << "') has Components < 1.";
+            throw Plato::ParsingException(tMsg.str());
+        }
+        tSharedDataInfo.setNumComponents(tMyName, tMyNumComponents);
+
+        // value type of field layouts: DOUBLE (default) or INTEGER
+        std::string tMyValueType = Plato::Get::String(tNode, "ValueType", std::string("DOUBLE"));
+        Parse::toUppercase(tMyValueType);
+        if(tMyValueType != "DOUBLE" && tMyValueType != "INTEGER")
+        {
+            std::stringstream tMsg;
+            tMsg << "Plato::Interface: SharedData ('" << tMyName << "') has unknown ValueType ('" << tMyValueType
+                 << "').  Options are DOUBLE and INTEGER.";
+            throw Plato::ParsingException(tMsg.str());
+        }
+        tSharedDataInfo.setIntegerData(tMyName, tMyValueType == "INTEGER");
+
+        // field values on the wire: DOUBLE (default), FLOAT (half the volume), or COMPRESSED (lossless)
+        std::string tMyEncoding = Plato::Get::String(tNode, "TransmitEncoding", std::string("DOUBLE"));
+        Parse::toUppercase(tMyEncoding);
+        if(tMyEncoding == "FLOAT")
+        {
+            tSharedDataInfo.setTransmitEncoding(tMyName, Plato::communication::encoding_t::FLOAT);
+        }
+        else if(tMyEncoding == "COMPRESSED")
+        {
+            tSharedDataInfo.setTransmitEncoding(tMyName, Plato::communication::encoding_t::COMPRESSED);
+        }
+        else if(tMyEncoding != "DOUBLE")
+        {
+            std::stringstream tMsg;
+            tMsg << "Plato::Interface: SharedData ('" << tMyName << "') has unknown TransmitEncoding ('" << tMyEncoding
+                 << "').  Options are DOUBLE, FLOAT, and COMPRESSED.";
+            throw Plato::ParsingException(tMsg.str());
+        }
     }
 
     this->exportGraph(tSharedDataInfo, aApplication, tCommunicationData);
     mDataLayer = new Plato::DataLayer(tSharedDataInfo, tCommunicationData);
+
+    for(const auto & tOwnedGlobalIDs : tCommunicationData.mMyOwnedGlobalIDs)
+    {
+        mStageRecorder.recordOwnedIDs(tOwnedGlobalIDs.first, tOwnedGlobalIDs.second.size());
+    }
+    for(Plato::SharedData* tSharedData : mDataLayer->getSharedData())
+    {
+        mStageRecorder.recordField(tSharedData->myName(), tSharedData->myLayout(), tSharedData->size(), tSharedData->numComponents());
+    }
 }
 
 /******************************************************************************/
@@ -57,16 +57,20 @@
 #include <mpi.h>
 #include <vector>
 #include <string>
+#include <functional>
 
 #include "Plato_Parser.hpp"
 #include "Plato_DataLayer.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_SharedData.hpp"
+#include "Plato_RankBalance.hpp"
+#include "Plato_StageRecorder.hpp"
 
 namespace Plato
 {
 
 class Stage;
+class Operation;
 class Performer;
 class SharedData;
 class Application;
@@ -75,6 +79,8 @@ struct CommunicationData;
 
 enum stage_index_t
 {
+    RESTART_STAGE = -4,
+    CHECKPOINT_STAGE = -3,
     INVALID_STAGE = -2,
     TERMINATE_STAGE = -1
 };
@@ -101,6 +107,14 @@ public:
     void compute(const std::string & stageName, Teuchos::ParameterList & aArguments);
     void compute(const std::vector<std::string> & stageNames, Teuchos::ParameterList & aArguments);
 
+    // handle-based optimizer interface: resolve names once with bindStage/bindSharedData
+    int bindStage(const std::string & aStageName) const;
+    int bindSharedData(const std::string & aSharedDataName) const;
+    void compute(int aStageHandle, Teuchos::ParameterList & aArguments);
+    void compute(const std::vector<int> & aStageHandles, Teuchos::ParameterList & aArguments);
+    //! Number of stages computed so far; performer state can only have changed if this has
+    size_t getNumStageComputes() const;
+
     // TODO: deprecate this function.  'registerPerformer' is misleading.  
     void registerPerformer(Plato::Application* aApplication){ this->registerApplication(aApplication); }
     void registerApplication(Plato::Application* aApplication);
@@ -110,6 +124,22 @@ public:
     int size(const std::string & aName) const;
     void exportData(double* aFrom, Plato::SharedData* aTo);
     void importData(double* aTo, Plato::SharedData* aFrom);
+    void exportData(double* aFrom, int aSharedDataHandle);
+    void importData(double* aTo, int aSharedDataHandle);
+    //! Send buffer of aName if it exists and holds aLength values on this rank, otherwise nullptr
+    double* getSendDataView(const std::string & aName, int aLength);
+
+    // checkpoint/restart of every performer's shared data; collective, called by the optimizer.
+    // every checkpoint is tagged with a counter so the optimizer's own checkpoint can be paired with it,
+    // and checkpoints alternate between two slots so a crash while writing one keeps the previous one.
+    // readCheckpoint restores the newest tag found in the same slot on every rank; aOptimizerTags holds
+    // the tag of the optimizer's own file in each slot (-1 if unreadable) and aReadOptimizer restores
+    // the optimizer from the chosen slot. It fails on every rank if no slot is complete.
+    void writeCheckpoint();
+    void readCheckpoint(const std::vector<int> & aOptimizerTags = std::vector<int>(),
+                        const std::function<void(int aSlot)> & aReadOptimizer = nullptr);
+    int getCheckpointTag() const;
+    const std::string & getCheckpointFileName() const;
 
     // local communicator functionality
     void getLocalComm(MPI_Comm& aLocalComm);
@@ -133,7 +163,14 @@ public:
 
 private:
     void perform(Plato::Stage* aStage);
+    void perform(Plato::Operation* aOperation);
+    void performAndCheck(const std::vector<Plato::Operation*> & aOperations);
     void broadcastStageIndex(int & aStageIndex);
+    Plato::Stage* getStage(int aStageIndex);
+    Plato::Stage* selectStage(int aStageIndex);
+    void checkpointSharedData(int aStageIndex);
+    void writeSharedDataCheckpoint();
+    void readSharedDataCheckpoint();
 
     void createStages();
     void createPerformers();
@@ -162,6 +199,14 @@ private:
     MPI_Comm mLocalComm;
     MPI_Comm mGlobalComm;
     bool mIsDone;
+
+    std::string mCheckpointFileName;
+    int mCheckpointTag;
+    std::vector<int> mOptimizerCheckpointTags;
+    std::function<void(int aSlot)> mReadOptimizerCheckpoint;
+    size_t mNumStageComputes;
+    Plato::RankBalance mRankBalance;
+    Plato::StageRecorder mStageRecorder;
 };
 
 } /* namespace Plato */
@@ -186,5 +186,7 @@ MultiOperation(const Plato::OperationInputDataMng & aOperationDataMng,
             break;
         }
     }
+
+    this->bindArguments();
 }
 } // End namespace Plato
@@ -67,9 +67,19 @@ Operation(const ::Plato::OperationInputDataMng & aOperationDataMng,
               const std::vector<::Plato::SharedData*>& aSharedData) :
         m_performer(nullptr),
         m_operationName(),
+        m_performerNames(),
         m_inputData(),
-        m_outputData() { }
+        m_outputData()
 /******************************************************************************/
+{
+    // names of all performers participating in this operation, not just the
+    // local one.  Every rank needs these to build the same stage schedule.
+    const int tNumPerformers = aOperationDataMng.getNumPerformers();
+    for(int tPerformerIndex = 0; tPerformerIndex < tNumPerformers; tPerformerIndex++)
+    {
+        m_performerNames.push_back(aOperationDataMng.getPerformerName(tPerformerIndex));
+    }
+}
 
 /******************************************************************************/
 void 
@@ -102,31 +112,39 @@ addArgument(const std::string & tArgumentName,
     }
 }
 
-/******************************************************************************/
-Operation::~Operation()
-/******************************************************************************/
-{
-
-}
-
 /******************************************************************************/
 void
 Operation::
-sendInput()
+bindArguments()
 /******************************************************************************/
 {
-  for( SharedData* sd : m_inputData )
-    sd->transmitData();
+    // resolve the argument names of each shared data once, so import and export
+    // don't search the argument multimap on every call
+    m_inputArguments.clear();
+    for(Plato::SharedData* tSharedData : m_inputData)
+    {
+        auto tRange = m_argumentNames.equal_range(tSharedData->myName());
+        for(auto tIterator = tRange.first; tIterator != tRange.second; ++tIterator)
+        {
+            m_inputArguments.push_back(std::make_pair(tSharedData, tIterator->second));
+        }
+    }
+    m_outputArguments.clear();
+    for(Plato::SharedData* tSharedData : m_outputData)
+    {
+        auto tRange = m_argumentNames.equal_range(tSharedData->myName());
+        for(auto tIterator = tRange.first; tIterator != tRange.second; ++tIterator)
+        {
+            m_outputArguments.push_back(std::make_pair(tSharedData, tIterator->second));
+        }
+    }
 }
 
 /******************************************************************************/
-void
-Operation::
-sendOutput()
+Operation::~Operation()
 /******************************************************************************/
 {
-  for( SharedData* sd : m_outputData )
-    sd->transmitData();
+
 }
 
 /******************************************************************************/
@@ -155,6 +173,42 @@ getOutputDataNames() const
   return names;
 }
 
+/******************************************************************************/
+const std::vector<std::string> &
+Operation::
+getPerformerNames() const
+/******************************************************************************/
+{
+  return m_performerNames;
+}
+
+/******************************************************************************/
+const std::vector<Plato::SharedData*> &
+Operation::
+getInputData() const
+/******************************************************************************/
+{
+  return m_inputData;
+}
+
+/******************************************************************************/
+const std::vector<Plato::SharedData*> &
+Operation::
+getOutputData() const
+/******************************************************************************/
+{
+  return m_outputData;
+}
+
+/******************************************************************************/
+bool
+Operation::
+hasLocalPerformer() const
+/******************************************************************************/
+{
+  return m_performer != nullptr;
+}
+
 /******************************************************************************/
 void 
 Operation::
@@ -199,6 +253,32 @@ exportData(std::string aSharedDataName, SharedData* aExportData)
   }
 }
 
+/******************************************************************************/
+void
+Operation::
+importInputData()
+/******************************************************************************/
+{
+  if(m_performer){
+    for( auto & tArgument : m_inputArguments ){
+      m_performer->importData(tArgument.second, *tArgument.first);
+    }
+  }
+}
+
+/******************************************************************************/
+void
+Operation::
+exportOutputData()
+/******************************************************************************/
+{
+  if(m_performer){
+    for( auto & tArgument : m_outputArguments ){
+      m_performer->exportData(tArgument.second, *tArgument.first);
+    }
+  }
+}
+
 /******************************************************************************/
 std::string 
 Operation::
@@ -73,18 +73,25 @@ public:
               const std::shared_ptr<::Plato::Performer> aPerformer,
               const std::vector<::Plato::SharedData*>& aSharedData);
 
-    virtual void sendInput();
-    virtual void sendOutput();
     virtual void compute();
 
     virtual void importData(std::string sharedDataName, Plato::SharedData* sf);
     virtual void exportData(std::string sharedDataName, Plato::SharedData* sf);
 
+    // import/export every argument through the bindings resolved at construction
+    void importInputData();
+    void exportOutputData();
+
     std::string getPerformerName() const;
     std::string getOperationName() const;
     std::vector<std::string> getInputDataNames() const;
     std::vector<std::string> getOutputDataNames() const;
 
+    const std::vector<std::string> & getPerformerNames() const;
+    const std::vector<Plato::SharedData*> & getInputData() const;
+    const std::vector<Plato::SharedData*> & getOutputData() const;
+    bool hasLocalPerformer() const;
+
     void 
     setParameterValue(std::string paramName, double paramValue)
       { m_parameters[paramName]->setData({1,paramValue}); }
@@ -96,6 +103,8 @@ protected:
                      const std::vector<Plato::SharedData*>& aSharedData,
                      std::vector<Plato::SharedData*>& aLocalData);
 
+    void bindArguments();
+
     class Parameter : public Plato::SharedData {
       const std::string m_name;
       const std::string m_operation;
@@ -118,11 +127,16 @@ protected:
 
     std::shared_ptr<Performer> m_performer;
     std::string m_operationName;
+    std::vector<std::string> m_performerNames;
 
     std::vector<Plato::SharedData*> m_inputData;
     std::vector<Plato::SharedData*> m_outputData;
 
     std::multimap<std::string, std::string> m_argumentNames;
+
+    // (shared data, argument name) pairs resolved once from m_argumentNames
+    std::vector<std::pair<Plato::SharedData*, std::string>> m_inputArguments;
+    std::vector<std::pair<Plato::SharedData*, std::string>> m_outputArguments;
 };
 
 } // End namespace Plato
@@ -103,5 +103,7 @@ SingleOperation(const Plato::OperationInputDataMng & aOperationDataMng,
     {
         m_performer = aPerformer;
     }
+
+    this->bindArguments();
 }
 } // End namespace Plato
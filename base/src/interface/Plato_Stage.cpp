@@ -51,6 +51,7 @@
 #include "Plato_Operation.hpp"
 #include "Plato_OperationFactory.hpp"
 #include "Plato_SharedData.hpp"
+#include "Plato_SharedDataBatch.hpp"
 #include "Plato_Performer.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_Utils.hpp"
@@ -74,7 +75,15 @@ Stage::Stage(const Plato::StageInputDataMng & aStageInputData,
         m_operations(),
         m_inputData(),
         m_outputData(),
-        currentOperationIndex()
+        m_operationLevels(),
+        m_levelInputData(),
+        m_levelOutputData(),
+        m_batchTransmit(aStageInputData.getBatchTransmit(aStageInputData.getStageName())),
+        m_inputBatch(),
+        m_outputBatch(),
+        m_levelInputBatches(),
+        m_levelOutputBatches(),
+        m_exceptionCheck(aStageInputData.getExceptionCheck(aStageInputData.getStageName()))
 /******************************************************************************/
 {
     int tNumInputs = aStageInputData.getNumInputs();
@@ -128,6 +137,112 @@ Stage::Stage(const Plato::StageInputDataMng & aStageInputData,
         m_operations.push_back(opFactory.create(tOperationDataMng, aPerformer, aSharedData));
     }
 
+    this->scheduleOperations();
+
+    if(m_batchTransmit)
+    {
+        m_inputBatch = std::make_shared<Plato::SharedDataBatch>(m_inputData);
+        m_outputBatch = std::make_shared<Plato::SharedDataBatch>(m_outputData);
+        for(size_t tLevelIndex = 0u; tLevelIndex < m_operationLevels.size(); tLevelIndex++)
+        {
+            m_levelInputBatches.push_back(std::make_shared<Plato::SharedDataBatch>(m_levelInputData[tLevelIndex]));
+            m_levelOutputBatches.push_back(std::make_shared<Plato::SharedDataBatch>(m_levelOutputData[tLevelIndex]));
+        }
+    }
+}
+
+namespace
+{
+/******************************************************************************/
+bool intersects(const std::vector<std::string> & aFirst, const std::vector<std::string> & aSecond)
+/******************************************************************************/
+{
+    for(const std::string & tName : aFirst)
+    {
+        if(std::count(aSecond.begin(), aSecond.end(), tName))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // end anonymous namespace
+
+/******************************************************************************/
+std::vector<int> Stage::computeLevels(const std::vector<Dependencies> & aOperations)
+/******************************************************************************/
+{
+    // Operation B depends on an earlier operation A if B reads data that A writes,
+    // if B writes data that A reads (A has to see the value from before B), if both
+    // write the same data, or if they share a performer (the hosted code may carry
+    // state between operations that the data graph doesn't see).
+    //
+    // Each operation is placed one level below the deepest operation it depends on.
+    // The schedule only depends on the input file, so it is identical on all ranks
+    // and the collective transmits at level boundaries match up.
+    //
+    const size_t tNumOperations = aOperations.size();
+    std::vector<int> tLevels(tNumOperations, 0);
+    for(size_t tOpIndex = 0u; tOpIndex < tNumOperations; tOpIndex++)
+    {
+        const Dependencies & tOperation = aOperations[tOpIndex];
+        for(size_t tPriorIndex = 0u; tPriorIndex < tOpIndex; tPriorIndex++)
+        {
+            const Dependencies & tPrior = aOperations[tPriorIndex];
+            bool tIsDependent = intersects(tOperation.mInputs, tPrior.mOutputs)
+                             || intersects(tOperation.mOutputs, tPrior.mInputs)
+                             || intersects(tOperation.mOutputs, tPrior.mOutputs)
+                             || intersects(tOperation.mPerformers, tPrior.mPerformers);
+            if(tIsDependent)
+            {
+                tLevels[tOpIndex] = std::max(tLevels[tOpIndex], tLevels[tPriorIndex] + 1);
+            }
+        }
+    }
+    return tLevels;
+}
+
+/******************************************************************************/
+void Stage::scheduleOperations()
+/******************************************************************************/
+{
+    const size_t tNumOperations = m_operations.size();
+    std::vector<Dependencies> tDependencies(tNumOperations);
+    for(size_t tOpIndex = 0u; tOpIndex < tNumOperations; tOpIndex++)
+    {
+        tDependencies[tOpIndex].mInputs = m_operations[tOpIndex]->getInputDataNames();
+        tDependencies[tOpIndex].mOutputs = m_operations[tOpIndex]->getOutputDataNames();
+        tDependencies[tOpIndex].mPerformers = m_operations[tOpIndex]->getPerformerNames();
+    }
+    const std::vector<int> tLevels = Stage::computeLevels(tDependencies);
+    const int tNumLevels = tLevels.empty() ? 0 : *std::max_element(tLevels.begin(), tLevels.end()) + 1;
+
+    m_operationLevels.assign(tNumLevels, std::vector<Plato::Operation*>());
+    m_levelInputData.assign(tNumLevels, std::vector<Plato::SharedData*>());
+    m_levelOutputData.assign(tNumLevels, std::vector<Plato::SharedData*>());
+    for(size_t tOpIndex = 0u; tOpIndex < tNumOperations; tOpIndex++)
+    {
+        const int tLevel = tLevels[tOpIndex];
+        Plato::Operation* tOperation = m_operations[tOpIndex];
+        m_operationLevels[tLevel].push_back(tOperation);
+
+        for(Plato::SharedData* tSharedData : tOperation->getInputData())
+        {
+            std::vector<Plato::SharedData*> & tInputs = m_levelInputData[tLevel];
+            if(std::count(tInputs.begin(), tInputs.end(), tSharedData) == 0)
+            {
+                tInputs.push_back(tSharedData);
+            }
+        }
+        for(Plato::SharedData* tSharedData : tOperation->getOutputData())
+        {
+            std::vector<Plato::SharedData*> & tOutputs = m_levelOutputData[tLevel];
+            if(std::count(tOutputs.begin(), tOutputs.end(), tSharedData) == 0)
+            {
+                tOutputs.push_back(tSharedData);
+            }
+        }
+    }
 }
 
 /******************************************************************************/
@@ -165,39 +280,113 @@ std::vector<std::string> Stage::getOutputDataNames() const
     }
     return tNames;
 }
+
+/******************************************************************************/
+std::vector<Plato::SharedData*> Stage::getTransmitSequence() const
+/******************************************************************************/
+{
+    std::vector<Plato::SharedData*> tSequence(m_inputData);
+    for(size_t tLevelIndex = 0; tLevelIndex < m_operationLevels.size(); tLevelIndex++)
+    {
+        tSequence.insert(tSequence.end(), m_levelInputData[tLevelIndex].begin(), m_levelInputData[tLevelIndex].end());
+        tSequence.insert(tSequence.end(), m_levelOutputData[tLevelIndex].begin(), m_levelOutputData[tLevelIndex].end());
+    }
+    tSequence.insert(tSequence.end(), m_outputData.begin(), m_outputData.end());
+    return tSequence;
+}
 /******************************************************************************/
 void Stage::begin()
 /******************************************************************************/
 {
+    // stage inputs may have been set by the caller since the last transmit
     for(Plato::SharedData* tSharedData : m_inputData)
     {
-        tSharedData->transmitData();
+        tSharedData->markModified();
+    }
+
+    if(m_batchTransmit)
+    {
+        m_inputBatch->transmitData();
+    }
+    else
+    {
+        for(Plato::SharedData* tSharedData : m_inputData)
+        {
+            tSharedData->transmitData();
+        }
+    }
+}
+
+/******************************************************************************/
+int Stage::getNumOperationLevels() const
+/******************************************************************************/
+{
+    return m_operationLevels.size();
+}
+
+/******************************************************************************/
+const std::vector<Plato::Operation*> &
+Stage::getOperationLevel(int aLevelIndex) const
+/******************************************************************************/
+{
+    return m_operationLevels[aLevelIndex];
+}
+
+/******************************************************************************/
+void Stage::beginOperationLevel(int aLevelIndex)
+/******************************************************************************/
+{
+    if(m_batchTransmit)
+    {
+        m_levelInputBatches[aLevelIndex]->transmitData();
+    }
+    else
+    {
+        for(Plato::SharedData* tSharedData : m_levelInputData[aLevelIndex])
+        {
+            tSharedData->transmitData();
+        }
     }
-    // reset to first operation
-    currentOperationIndex = 0;
 }
 
 /******************************************************************************/
-Plato::Operation*
-Stage::getNextOperation()
+void Stage::endOperationLevel(int aLevelIndex)
 /******************************************************************************/
 {
-    Plato::Operation* tOperation = nullptr;
-    if(static_cast<int>(m_operations.size()) > currentOperationIndex)
+    // every rank marks the level's outputs, whether or not it ran the operations,
+    // so skipped transmits match across ranks
+    for(Plato::SharedData* tSharedData : m_levelOutputData[aLevelIndex])
+    {
+        tSharedData->markModified();
+    }
+
+    if(m_batchTransmit)
+    {
+        m_levelOutputBatches[aLevelIndex]->transmitData();
+    }
+    else
     {
-        tOperation = m_operations[currentOperationIndex];
+        for(Plato::SharedData* tSharedData : m_levelOutputData[aLevelIndex])
+        {
+            tSharedData->transmitData();
+        }
     }
-    currentOperationIndex++;
-    return tOperation;
 }
 
 /******************************************************************************/
 void Stage::end()
 /******************************************************************************/
 {
-    for(Plato::SharedData* tSharedData : m_outputData)
+    if(m_batchTransmit)
+    {
+        m_outputBatch->transmitData();
+    }
+    else
     {
-        tSharedData->transmitData();
+        for(Plato::SharedData* tSharedData : m_outputData)
+        {
+            tSharedData->transmitData();
+        }
     }
 }
 
@@ -59,11 +59,16 @@ namespace Plato
 
 class Performer;
 class SharedData;
+class SharedDataBatch;
 class Operation;
 class StageInputDataMng;
 
 //! Sequence of Operations that correspond to a call to Plato::Interface::compute()
 /*!
+ Operations are grouped into levels.  Operations in the same level have no
+ data dependency on each other and don't share a performer, so each performer
+ can execute its part of a level without waiting on the others.  Shared data
+ is only transmitted at level boundaries.
  */
 class Stage
 {
@@ -73,16 +78,47 @@ public:
           const std::vector<Plato::SharedData*>& aSharedData);
     ~Stage();
 
-    Plato::Operation* getNextOperation();
     void begin();
     void end();
 
+    int getNumOperationLevels() const;
+    const std::vector<Plato::Operation*> & getOperationLevel(int aLevelIndex) const;
+    void beginOperationLevel(int aLevelIndex);
+    void endOperationLevel(int aLevelIndex);
+
     std::string getName() const
     {
         return m_name;
     }
+    std::string getExceptionCheck() const
+    {
+        return m_exceptionCheck;
+    }
     std::vector<std::string> getInputDataNames() const;
     std::vector<std::string> getOutputDataNames() const;
+    //! Shared data in the order the stage transmits it: stage input, each level's input and output, stage output
+    std::vector<Plato::SharedData*> getTransmitSequence() const;
+    const std::vector<Plato::SharedData*> & getInputData() const
+    {
+        return m_inputData;
+    }
+    const std::vector<Plato::SharedData*> & getOutputData() const
+    {
+        return m_outputData;
+    }
+
+    //! Names an operation reads, writes, and runs on; the input to the level schedule
+    struct Dependencies
+    {
+        std::vector<std::string> mInputs;
+        std::vector<std::string> mOutputs;
+        std::vector<std::string> mPerformers;
+    };
+    //! Level of each operation, in input file order
+    static std::vector<int> computeLevels(const std::vector<Dependencies> & aOperations);
+
+private:
+    void scheduleOperations();
 
 private:
     std::string m_name;
@@ -90,7 +126,17 @@ private:
     std::vector<Plato::SharedData*> m_inputData;
     std::vector<Plato::SharedData*> m_outputData;
 
-    int currentOperationIndex;
+    std::vector<std::vector<Plato::Operation*>> m_operationLevels;
+    std::vector<std::vector<Plato::SharedData*>> m_levelInputData;
+    std::vector<std::vector<Plato::SharedData*>> m_levelOutputData;
+
+    bool m_batchTransmit;
+    std::shared_ptr<Plato::SharedDataBatch> m_inputBatch;
+    std::shared_ptr<Plato::SharedDataBatch> m_outputBatch;
+    std::vector<std::shared_ptr<Plato::SharedDataBatch>> m_levelInputBatches;
+    std::vector<std::shared_ptr<Plato::SharedDataBatch>> m_levelOutputBatches;
+
+    std::string m_exceptionCheck;
 };
 
 } // End namespace Plato
@@ -82,6 +82,21 @@ public:
         Plato::fill(static_cast<ScalarType>(0), aOutput);
         mCriterion->gradient(aControl, aOutput);
     }
+    ScalarType computeWithValue(Plato::Criterion<ScalarType, OrdinalType> & aCriterion,
+                                const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        if(&aCriterion != mCriterion.get())
+        {
+            return (Plato::GradientOperator<ScalarType, OrdinalType>::computeWithValue(aCriterion, aControl, aOutput));
+        }
+        Plato::fill(static_cast<ScalarType>(0), aOutput);
+        return (mCriterion->valueAndGradient(aControl, aOutput));
+    }
+    bool hasFusedValueAndGradient(const Plato::Criterion<ScalarType, OrdinalType> & aCriterion) const
+    {
+        return (&aCriterion == mCriterion.get() && mCriterion->hasFusedValueAndGradient());
+    }
 
 private:
     std::shared_ptr<Plato::Criterion<ScalarType, OrdinalType>> mCriterion;
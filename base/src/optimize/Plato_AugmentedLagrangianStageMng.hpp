@@ -582,10 +582,51 @@ public:
         mNormObjFuncGrad = mIsMeanNormEnabled == true ? Plato::norm_mean(aOutput) : Plato::norm(aOutput);
         mNumObjGradEval++;
 
-        this->computeAugmentedLagrangianGradient(aControl, aOutput);
+        this->computeAugmentedLagrangianGradient(aControl, *mCurrentConstraintValues, aOutput);
         mNormAugLagFuncGrad = mIsMeanNormEnabled == true ? Plato::norm_mean(aOutput) : Plato::norm(aOutput);
     }
 
+    /******************************************************************************//**
+     * @brief Evaluate augmented Lagrangian function and compute its gradient at the same control
+     * @param [in] aControl optimization variables
+     * @param [out] aOutput augmented Lagrangian gradient
+     * @param [in] aTolerance objective inexactness tolerance
+     * @return augmented Lagrangian function value
+    **********************************************************************************/
+    ScalarType evaluateObjectiveAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                            Plato::MultiVector<ScalarType, OrdinalType> & aOutput,
+                                            ScalarType aTolerance = std::numeric_limits<ScalarType>::max())
+    {
+        assert(mObjectiveGradientOperator.get() != nullptr);
+
+        // Evaluate objective function and its gradient: f(\mathbf{z}) and \frac{\partial f}{\partial\mathbf{z}}
+        Plato::fill(static_cast<ScalarType>(0), aOutput);
+        mTrialObjFuncValue = mObjectiveGradientOperator->computeWithValue(*mObjective, aControl, aOutput);
+        mNormObjFuncGrad = mIsMeanNormEnabled == true ? Plato::norm_mean(aOutput) : Plato::norm(aOutput);
+        mNumObjFuncEval++;
+        mNumObjGradEval++;
+
+        // Evaluate inequality constraints, h(\mathbf{u}(\mathbf{z}),\mathbf{z})
+        this->evaluateConstraint(aControl, *mTrialConstraintValues);
+
+        // Evaluate augmented Lagrangian and its gradient; the trial constraint values were evaluated at aControl
+        mTrialAugLagFuncValue = this->evaluateAugmentedLagrangianCriterion(mTrialObjFuncValue);
+        this->computeAugmentedLagrangianGradient(aControl, *mTrialConstraintValues, aOutput);
+        mNormAugLagFuncGrad = mIsMeanNormEnabled == true ? Plato::norm_mean(aOutput) : Plato::norm(aOutput);
+
+        return (mTrialAugLagFuncValue);
+    }
+
+    /******************************************************************************//**
+     * @brief Indicates if the objective value and gradient are computed in a single evaluation
+    **********************************************************************************/
+    bool hasFusedObjectiveAndGradient() const
+    {
+        assert(mObjective.get() != nullptr);
+        assert(mObjectiveGradientOperator.get() != nullptr);
+        return (mObjectiveGradientOperator->hasFusedValueAndGradient(*mObjective));
+    }
+
     /******************************************************************************//**
      * @brief Compute Hessian times vector
      * @param [in] aControl optimization variables
@@ -752,9 +793,11 @@ private:
     /******************************************************************************//**
      * @brief Compute augmented Lagrangian gradient
      * @param [in] aControl optimization variables
+     * @param [in] aConstraintValues inequality constraint values at aControl
      * @param [out] aOutput augmented Lagrangian gradient
     **********************************************************************************/
     void computeAugmentedLagrangianGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                            const Plato::MultiVector<ScalarType, OrdinalType> & aConstraintValues,
                                             Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
         assert(mConstraintGradientOperator.get() != nullptr);
@@ -768,7 +811,7 @@ private:
         {
             assert(mConstraintGradientOperator->ptr(tIndex).get() != nullptr);
 
-            const ScalarType tMyConstraintValue = (*mCurrentConstraintValues)(tDUAL_VEC_INDEX, tIndex);
+            const ScalarType tMyConstraintValue = aConstraintValues(tDUAL_VEC_INDEX, tIndex);
 
             // Add contribution from: \lambda_i\frac{\partial h_i}{\partial\mathbf{z}} to Lagrangian gradient
             Plato::MultiVector<ScalarType, OrdinalType> & tMyConstraintGradient =
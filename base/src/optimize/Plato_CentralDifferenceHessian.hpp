@@ -53,6 +53,7 @@
 #include "Plato_Criterion.hpp"
 #include "Plato_DataFactory.hpp"
 #include "Plato_MultiVector.hpp"
+#include "Plato_MultiVectorList.hpp"
 #include "Plato_LinearAlgebra.hpp"
 #include "Plato_LinearOperator.hpp"
 
@@ -67,9 +68,14 @@ public:
                                       const std::shared_ptr<Plato::Criterion<ScalarType, OrdinalType>> & aCriterion) :
             mEpsilon(1e-6),
             mCriterion(aCriterion),
-            mGradient(aFactory->control().create()),
-            mTrialControl(aFactory->control().create())
+            mTrialGradients(std::make_shared<Plato::MultiVectorList<ScalarType, OrdinalType>>()),
+            mTrialControls(std::make_shared<Plato::MultiVectorList<ScalarType, OrdinalType>>())
     {
+        // the forward and backward perturbations are evaluated as one batch
+        mTrialGradients->add(aFactory->control());
+        mTrialGradients->add(aFactory->control());
+        mTrialControls->add(aFactory->control());
+        mTrialControls->add(aFactory->control());
     }
     virtual ~CentralDifferenceHessian()
     {
@@ -90,17 +96,20 @@ public:
                Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
         // Compute \hat{x} = x_{current} + \epsilon d, where d denotes the direction vector and \epsilon denotes the perturbation
-        Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *mTrialControl);
-        Plato::update(mEpsilon, aVector, static_cast<ScalarType>(1), *mTrialControl);
-        mCriterion->gradient(*mTrialControl, aOutput);
+        Plato::MultiVector<ScalarType, OrdinalType> & tForwardControl = (*mTrialControls)[0];
+        Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), tForwardControl);
+        Plato::update(mEpsilon, aVector, static_cast<ScalarType>(1), tForwardControl);
 
         // Compute \hat{x} = x_{current} - \epsilon d, where d denotes the direction vector and \epsilon denotes the perturbation
-        Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *mTrialControl);
-        Plato::update(-mEpsilon, aVector, static_cast<ScalarType>(1), *mTrialControl);
-        mCriterion->gradient(*mTrialControl, *mGradient);
+        Plato::MultiVector<ScalarType, OrdinalType> & tBackwardControl = (*mTrialControls)[1];
+        Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), tBackwardControl);
+        Plato::update(-mEpsilon, aVector, static_cast<ScalarType>(1), tBackwardControl);
+
+        mCriterion->gradients(*mTrialControls, *mTrialGradients);
 
         // Compute central difference approximation
-        Plato::update(static_cast<ScalarType>(-1), *mGradient, static_cast<ScalarType>(1), aOutput);
+        Plato::update(static_cast<ScalarType>(1), (*mTrialGradients)[0], static_cast<ScalarType>(0), aOutput);
+        Plato::update(static_cast<ScalarType>(-1), (*mTrialGradients)[1], static_cast<ScalarType>(1), aOutput);
         const ScalarType tConstant = static_cast<ScalarType>(0.5) / mEpsilon;
         Plato::scale(tConstant, aOutput);
     }
@@ -108,8 +117,8 @@ public:
 private:
     ScalarType mEpsilon;
     std::shared_ptr<Plato::Criterion<ScalarType, OrdinalType>> mCriterion;
-    std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mGradient;
-    std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mTrialControl;
+    std::shared_ptr<Plato::MultiVectorList<ScalarType, OrdinalType>> mTrialGradients;
+    std::shared_ptr<Plato::MultiVectorList<ScalarType, OrdinalType>> mTrialControls;
 
 private:
     CentralDifferenceHessian(const Plato::CentralDifferenceHessian<ScalarType, OrdinalType> & aRhs);
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_CheckpointUtilities.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "Plato_Vector.hpp"
+#include "Plato_Checkpoint.hpp"
+#include "Plato_MultiVector.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Write the local entries of a vector to a checkpoint
+ * @param [in] aName record name
+ * @param [in] aInput vector
+ * @param [in,out] aWriter checkpoint writer
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType>
+void write_checkpoint(const std::string & aName,
+                      const Plato::Vector<ScalarType, OrdinalType> & aInput,
+                      Plato::CheckpointWriter & aWriter)
+{
+    const OrdinalType tLength = aInput.size();
+    std::vector<double> tData(tLength);
+    for(OrdinalType tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        tData[tIndex] = aInput[tIndex];
+    }
+    aWriter.write(aName, tData);
+}
+
+/******************************************************************************//**
+ * @brief Read the local entries of a vector from a checkpoint
+ * @param [in] aName record name
+ * @param [in] aReader checkpoint reader
+ * @param [out] aOutput vector; its length must match the record
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType>
+void read_checkpoint(const std::string & aName,
+                     const Plato::CheckpointReader & aReader,
+                     Plato::Vector<ScalarType, OrdinalType> & aOutput)
+{
+    const OrdinalType tLength = aOutput.size();
+    std::vector<double> tData(tLength);
+    aReader.read(aName, tData.data(), tData.size());
+    for(OrdinalType tIndex = 0; tIndex < tLength; tIndex++)
+    {
+        aOutput[tIndex] = tData[tIndex];
+    }
+}
+
+/******************************************************************************//**
+ * @brief Write the local entries of a multi-vector to a checkpoint, one record per vector
+ * @param [in] aName record name prefix
+ * @param [in] aInput multi-vector
+ * @param [in,out] aWriter checkpoint writer
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType>
+void write_checkpoint(const std::string & aName,
+                      const Plato::MultiVector<ScalarType, OrdinalType> & aInput,
+                      Plato::CheckpointWriter & aWriter)
+{
+    const OrdinalType tNumVectors = aInput.getNumVectors();
+    for(OrdinalType tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+    {
+        std::stringstream tName;
+        tName << aName << "/" << tVectorIndex;
+        Plato::write_checkpoint(tName.str(), aInput[tVectorIndex], aWriter);
+    }
+}
+
+/******************************************************************************//**
+ * @brief Read the local entries of a multi-vector from a checkpoint
+ * @param [in] aName record name prefix
+ * @param [in] aReader checkpoint reader
+ * @param [out] aOutput multi-vector
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType>
+void read_checkpoint(const std::string & aName,
+                     const Plato::CheckpointReader & aReader,
+                     Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+{
+    const OrdinalType tNumVectors = aOutput.getNumVectors();
+    for(OrdinalType tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+    {
+        std::stringstream tName;
+        tName << aName << "/" << tVectorIndex;
+        Plato::read_checkpoint(tName.str(), aReader, aOutput[tVectorIndex]);
+    }
+}
+
+} // namespace Plato
@@ -141,6 +141,23 @@ public:
     virtual void solve(Plato::ConservativeConvexSeparableAppxStageMng<ScalarType, OrdinalType> & aStageMng,
                        Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng) = 0;
     virtual void initializeAuxiliaryVariables(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng) = 0;
+
+    /******************************************************************************//**
+     * @brief Return true if the subproblem sets the objective gradient at the control it accepts.
+    **********************************************************************************/
+    virtual bool computesObjectiveGradient() const
+    {
+        return (false);
+    }
+
+    /******************************************************************************//**
+     * @brief Restore the subproblem state from the data manager after a restart.
+     * @param [in,out] aDataMng data manager with the restored problem data
+    **********************************************************************************/
+    virtual void restoreAuxiliaryVariables(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng)
+    {
+        this->initializeAuxiliaryVariables(aDataMng);
+    }
 };
 
 } // namespace Plato
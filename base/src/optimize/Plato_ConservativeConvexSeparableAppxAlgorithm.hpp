@@ -55,6 +55,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
 
 #include "Plato_Vector.hpp"
 #include "Plato_ErrorChecks.hpp"
@@ -85,8 +86,12 @@ public:
                                              const std::shared_ptr<Plato::ConservativeConvexSeparableApproximation<ScalarType, OrdinalType>> & aSubProblem) :
             mPrintDiagnostics(false),
             mOutputStream(),
+            mIsRestart(false),
+            mHaveCurrentObjectiveGradient(false),
             mMaxNumOuterIter(500),
             mNumOuterIterDone(0),
+            mCheckpointFrequency(0),
+            mCheckpointFunction(),
             mStationarityTolerance(1e-4),
             mControlStagnationTolerance(1e-8),
             mObjectiveStagnationTolerance(1e-6),
@@ -340,6 +345,42 @@ public:
         return (*mDataMng);
     }
 
+    /******************************************************************************//**
+     * @brief Call a function every aFrequency outer iterations, e.g. to write a checkpoint
+     * @param [in] aFrequency number of outer iterations between calls; zero disables the calls
+     * @param [in] aFunction function called after the outer iteration is done
+    **********************************************************************************/
+    void setCheckpointFunction(const OrdinalType & aFrequency, const std::function<void()> & aFunction)
+    {
+        mCheckpointFrequency = aFrequency;
+        mCheckpointFunction = aFunction;
+    }
+
+    /******************************************************************************//**
+     * @brief Write this rank's part of the algorithm state to a checkpoint
+     * @param [in,out] aWriter checkpoint writer
+    **********************************************************************************/
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+    {
+        mDataMng->writeCheckpoint(aWriter);
+        Plato::write_checkpoint("ccsa/previous_sigma", *mPreviousSigma, aWriter);
+        Plato::write_checkpoint("ccsa/antepenultimate_control", *mAntepenultimateControl, aWriter);
+        aWriter.write("ccsa/num_iterations", static_cast<double>(mNumOuterIterDone));
+    }
+
+    /******************************************************************************//**
+     * @brief Restore the algorithm state; solve() then continues from the checkpointed iteration
+     * @param [in] aReader checkpoint reader
+    **********************************************************************************/
+    void readCheckpoint(const Plato::CheckpointReader & aReader)
+    {
+        mDataMng->readCheckpoint(aReader);
+        Plato::read_checkpoint("ccsa/previous_sigma", aReader, *mPreviousSigma);
+        Plato::read_checkpoint("ccsa/antepenultimate_control", aReader, *mAntepenultimateControl);
+        mNumOuterIterDone = aReader.read("ccsa/num_iterations");
+        mIsRestart = true;
+    }
+
     /******************************************************************************//**
      * @brief Solve optimization problem using Optimality criteria algorithm
     **********************************************************************************/
@@ -347,7 +388,14 @@ public:
     {
         this->openOutputFile();
         this->checkInitialGuess();
-        this->setInitialProblemData();
+        if(mIsRestart == true)
+        {
+            this->restoreProblemData();
+        }
+        else
+        {
+            this->setInitialProblemData();
+        }
 
         while(1)
         {
@@ -366,7 +414,10 @@ public:
             this->saveProblemData();
 
             mSubProblem->solve(*mStageMng, *mDataMng);
+            mHaveCurrentObjectiveGradient = mSubProblem->computesObjectiveGradient();
             mNumOuterIterDone++;
+
+            this->conditionallyWriteCheckpoint();
         }
     }
 
@@ -384,8 +435,16 @@ private:
                 const OrdinalType tNumConstraints = mDataMng->getNumConstraints();
                 mOutputData.mConstraints.clear();
                 mOutputData.mConstraints.resize(tNumConstraints);
-                mOutputStream.open("plato_ccsa_algorithm_diagnostics.txt");
-                Plato::print_ccsa_diagnostics_header(mOutputData, mOutputStream, mPrintDiagnostics);
+                if(mIsRestart == true)
+                {
+                    // a restarted run continues the diagnostics of the run it restarts
+                    mOutputStream.open("plato_ccsa_algorithm_diagnostics.txt", std::ios::app);
+                }
+                else
+                {
+                    mOutputStream.open("plato_ccsa_algorithm_diagnostics.txt");
+                    Plato::print_ccsa_diagnostics_header(mOutputData, mOutputStream, mPrintDiagnostics);
+                }
             }
         }
     }
@@ -462,19 +521,42 @@ private:
     {
         const Plato::MultiVector<ScalarType, OrdinalType> & tCurrentControl = mDataMng->getCurrentControl();
         mStageMng->cacheData();
-        mStageMng->computeGradient(tCurrentControl, *mControlWork);
-        mDataMng->setCurrentObjectiveGradient(*mControlWork);
+        // the objective gradient may have been computed along with the objective value at the current control
+        if(mHaveCurrentObjectiveGradient == false)
+        {
+            mStageMng->computeGradient(tCurrentControl, *mControlWork);
+            mDataMng->setCurrentObjectiveGradient(*mControlWork);
+        }
         mStageMng->computeConstraintGradients(tCurrentControl, *mWorkMultiVectorList);
         mDataMng->setCurrentConstraintGradients(*mWorkMultiVectorList);
     }
 
+    /******************************************************************************//**
+     * @brief Evaluate the objective at the current control. The objective gradient is computed in the same
+     * evaluation only if the stage manager fuses them; otherwise, it is computed after the criteria data
+     * are cached (see computeCurrentGradients).
+     * @param [in] aControl current control
+     * @return objective function value
+    **********************************************************************************/
+    ScalarType evaluateObjective(const Plato::MultiVector<ScalarType, OrdinalType> & aControl)
+    {
+        mHaveCurrentObjectiveGradient = mStageMng->hasFusedObjectiveAndGradient();
+        if(mHaveCurrentObjectiveGradient == false)
+        {
+            return (mStageMng->evaluateObjective(aControl));
+        }
+        const ScalarType tObjFuncValue = mStageMng->evaluateObjectiveAndGradient(aControl, *mControlWork);
+        mDataMng->setCurrentObjectiveGradient(*mControlWork);
+        return (tObjFuncValue);
+    }
+
     /******************************************************************************//**
      * @brief Compute initial objective and constraint values and initialize auxiliary variables.
     **********************************************************************************/
     void setInitialProblemData()
     {
         const Plato::MultiVector<ScalarType, OrdinalType> & tControl = mDataMng->getCurrentControl();
-        const ScalarType tInitialObjFuncValue = mStageMng->evaluateObjective(tControl);
+        const ScalarType tInitialObjFuncValue = this->evaluateObjective(tControl);
         mDataMng->setCurrentObjectiveFunctionValue(tInitialObjFuncValue);
         mStageMng->evaluateConstraints(tControl, *mDualWork);
         mDataMng->setCurrentConstraintValues(*mDualWork);
@@ -482,6 +564,34 @@ private:
         mSubProblem->initializeAuxiliaryVariables(*mDataMng);
     }
 
+    /******************************************************************************//**
+     * @brief Re-evaluate the criteria at a restored control.  The asymptotes, duals and
+     * control history come from the checkpoint; the evaluation recreates the simulation
+     * state that the following gradient computations rely on and the subproblem restarts
+     * its dual solve from the checkpointed dual.
+    **********************************************************************************/
+    void restoreProblemData()
+    {
+        const Plato::MultiVector<ScalarType, OrdinalType> & tControl = mDataMng->getCurrentControl();
+        const ScalarType tObjFuncValue = this->evaluateObjective(tControl);
+        mDataMng->setCurrentObjectiveFunctionValue(tObjFuncValue);
+        mStageMng->evaluateConstraints(tControl, *mDualWork);
+        mDataMng->setCurrentConstraintValues(*mDualWork);
+        mSubProblem->restoreAuxiliaryVariables(*mDataMng);
+    }
+
+    /******************************************************************************//**
+     * @brief Call the checkpoint function if this iteration is a multiple of the checkpoint frequency.
+    **********************************************************************************/
+    void conditionallyWriteCheckpoint()
+    {
+        const bool tHaveCheckpointFrequency = mCheckpointFrequency > static_cast<OrdinalType>(0);
+        if(tHaveCheckpointFrequency && (mNumOuterIterDone % mCheckpointFrequency) == static_cast<OrdinalType>(0))
+        {
+            mCheckpointFunction();
+        }
+    }
+
     /******************************************************************************//**
      * @brief Save previous and antepenultimate criteria values and controls.
     **********************************************************************************/
@@ -676,8 +786,12 @@ private:
     bool mPrintDiagnostics;
     std::ofstream mOutputStream;
 
+    bool mIsRestart;
+    bool mHaveCurrentObjectiveGradient;
     OrdinalType mMaxNumOuterIter;
     OrdinalType mNumOuterIterDone;
+    OrdinalType mCheckpointFrequency;
+    std::function<void()> mCheckpointFunction;
 
     ScalarType mStationarityTolerance;
     ScalarType mControlStagnationTolerance;
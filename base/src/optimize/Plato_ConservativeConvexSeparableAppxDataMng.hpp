@@ -65,6 +65,7 @@
 #include "Plato_StandardVector.hpp"
 #include "Plato_MultiVectorList.hpp"
 #include "Plato_ReductionOperations.hpp"
+#include "Plato_CheckpointUtilities.hpp"
 #include "Plato_HostPrimalProbElementWise.hpp"
 #include "Plato_DevicePrimalProbElementWise.hpp"
 
@@ -914,6 +915,49 @@ public:
         return (*mElementWiseFunctions);
     }
 
+    /******************************************************************************//**
+     * @brief Write this rank's part of the iterate, asymptote and dual data to a checkpoint
+     * @param [in,out] aWriter checkpoint writer
+    **********************************************************************************/
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+    {
+        Plato::write_checkpoint("ccsa/dual", *mDual, aWriter);
+        Plato::write_checkpoint("ccsa/current_sigma", *mCurrentSigma, aWriter);
+        Plato::write_checkpoint("ccsa/current_control", *mCurrentControl, aWriter);
+        Plato::write_checkpoint("ccsa/previous_control", *mPreviousControl, aWriter);
+        Plato::write_checkpoint("ccsa/current_constraint_values", *mCurrentConstraintValues, aWriter);
+        Plato::write_checkpoint("ccsa/current_objective_gradient", *mCurrentObjectiveGradient, aWriter);
+        Plato::write_checkpoint("ccsa/constraint_globalization_factors", *mConstraintGlobalizationFactors, aWriter);
+
+        aWriter.write("ccsa/num_objective_evaluations", static_cast<double>(mNumObjFuncEval));
+        aWriter.write("ccsa/num_objective_gradient_evaluations", static_cast<double>(mNumObjGradEval));
+        aWriter.write("ccsa/current_objective_value", static_cast<double>(mCurrentObjectiveFunctionValue));
+        aWriter.write("ccsa/previous_objective_value", static_cast<double>(mPreviousObjectiveFunctionValue));
+        aWriter.write("ccsa/dual_objective_globalization_factor", static_cast<double>(mDualObjectiveGlobalizationFactor));
+    }
+
+    /******************************************************************************//**
+     * @brief Restore data written by writeCheckpoint
+     * @param [in] aReader checkpoint reader
+    **********************************************************************************/
+    void readCheckpoint(const Plato::CheckpointReader & aReader)
+    {
+        Plato::read_checkpoint("ccsa/dual", aReader, *mDual);
+        Plato::read_checkpoint("ccsa/current_sigma", aReader, *mCurrentSigma);
+        Plato::read_checkpoint("ccsa/current_control", aReader, *mCurrentControl);
+        Plato::read_checkpoint("ccsa/previous_control", aReader, *mPreviousControl);
+        Plato::read_checkpoint("ccsa/current_constraint_values", aReader, *mCurrentConstraintValues);
+        Plato::read_checkpoint("ccsa/current_objective_gradient", aReader, *mCurrentObjectiveGradient);
+        Plato::read_checkpoint("ccsa/constraint_globalization_factors", aReader, *mConstraintGlobalizationFactors);
+
+        mNumObjFuncEval = aReader.read("ccsa/num_objective_evaluations");
+        mNumObjGradEval = aReader.read("ccsa/num_objective_gradient_evaluations");
+        mCurrentObjectiveFunctionValue = aReader.read("ccsa/current_objective_value");
+        mPreviousObjectiveFunctionValue = aReader.read("ccsa/previous_objective_value");
+        mDualObjectiveGlobalizationFactor = aReader.read("ccsa/dual_objective_globalization_factor");
+        mIsInitialGuessSet = true;
+    }
+
 private:
     void initializeBounds()
     {
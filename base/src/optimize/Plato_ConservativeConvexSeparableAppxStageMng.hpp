@@ -72,6 +72,20 @@ public:
     virtual ScalarType evaluateObjective(const Plato::MultiVector<ScalarType, OrdinalType> & aControl) = 0;
     virtual void computeGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                                  Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
+    //! Evaluate objective and compute its gradient at the same control; derived classes override this
+    //! method when both quantities can be computed in a single evaluation.
+    virtual ScalarType evaluateObjectiveAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                                    Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        const ScalarType tValue = this->evaluateObjective(aControl);
+        this->computeGradient(aControl, aOutput);
+        return (tValue);
+    }
+    //! Indicates if evaluateObjectiveAndGradient computes both quantities in a single evaluation
+    virtual bool hasFusedObjectiveAndGradient() const
+    {
+        return (false);
+    }
 
     virtual void evaluateConstraints(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                                      Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
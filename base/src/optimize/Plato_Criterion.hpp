@@ -50,13 +50,13 @@
 #define PLATO_CRITERION_HPP_
 
 #include <memory>
+#include <vector>
+
+#include "Plato_MultiVectorList.hpp"
 
 namespace Plato
 {
 
-template<typename ScalarType, typename OrdinalType>
-class MultiVector;
-
 template<typename ScalarType, typename OrdinalType = size_t>
 class Criterion
 {
@@ -98,6 +98,70 @@ public:
      **/
     virtual void gradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                           Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
+    /*!
+     * Evaluates the criterion and computes its gradient at the same control. Criteria that can produce both
+     * quantities from a single evaluation (e.g. one combined simulation stage) should override this method;
+     * the default evaluates the value and then the gradient.
+     *  Parameters:
+     *    \param In
+     *          aControl: control variables
+     *    \param Out
+     *          aOutput: gradient
+     *
+     *  \return Objective function value
+     **/
+    virtual ScalarType valueAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                        Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        const ScalarType tValue = this->value(aControl);
+        this->gradient(aControl, aOutput);
+        return (tValue);
+    }
+    /*!
+     * Indicates if valueAndGradient computes both quantities in a single evaluation. Callers that otherwise
+     * evaluate other criteria or cache data between the value and the gradient only fuse the two if it does.
+     **/
+    virtual bool hasFusedValueAndGradient() const
+    {
+        return (false);
+    }
+    /*!
+     * Evaluates the criterion at a batch of controls. Criteria that can evaluate several controls together
+     * (e.g. a batch stage that performs multi-RHS solves or spreads the controls over groups of ranks) should
+     * override this method; the default evaluates the controls one at a time.
+     *  Parameters:
+     *    \param In
+     *          aControls: list of control variables
+     *    \param Out
+     *          aOutput: criterion value at each control
+     **/
+    virtual void values(const Plato::MultiVectorList<ScalarType, OrdinalType> & aControls,
+                        std::vector<ScalarType> & aOutput)
+    {
+        aOutput.resize(aControls.size());
+        for(OrdinalType tIndex = 0; tIndex < aControls.size(); tIndex++)
+        {
+            aOutput[tIndex] = this->value(aControls[tIndex]);
+        }
+    }
+    /*!
+     * Computes the gradient of the criterion at a batch of controls. Criteria that can evaluate several controls
+     * together should override this method; the default computes the gradients one at a time.
+     *  Parameters:
+     *    \param In
+     *          aControls: list of control variables
+     *    \param Out
+     *          aOutput: gradient at each control
+     **/
+    virtual void gradients(const Plato::MultiVectorList<ScalarType, OrdinalType> & aControls,
+                           Plato::MultiVectorList<ScalarType, OrdinalType> & aOutput)
+    {
+        assert(aControls.size() == aOutput.size());
+        for(OrdinalType tIndex = 0; tIndex < aControls.size(); tIndex++)
+        {
+            this->gradient(aControls[tIndex], aOutput[tIndex]);
+        }
+    }
     /*!
      * Computes the application of a vector to the Hessian of a criterion of type f(\mathbf{u}(\mathbf{z}),\mathbf{z})
      * \colon\mathbb{R}^{n_u}\times\mathbb{R}^{n_z}\rightarrow\mathbb{R}, where u denotes the state and z denotes the
@@ -71,6 +71,11 @@ public:
     virtual void updateObjectiveCoefficients(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng) = 0;
     virtual void updateConstraintCoefficients(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng) = 0;
     virtual void initializeAuxiliaryVariables(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng) = 0;
+
+    //! Set the dual used as initial guess by the next solve, e.g. when restarting from a checkpoint.
+    virtual void setInitialGuess(const Plato::MultiVector<ScalarType, OrdinalType> & aDual)
+    {
+    }
 };
 
 } // namespace Plato
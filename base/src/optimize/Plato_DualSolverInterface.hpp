@@ -95,6 +95,10 @@ public:
     {
         mOptimizer->initializeAuxiliaryVariables(aDataMng);
     }
+    void setInitialGuess(const Plato::MultiVector<ScalarType, OrdinalType> & aDual)
+    {
+        Plato::update(static_cast<ScalarType>(1), aDual, static_cast<ScalarType>(0), *mInitialGuess);
+    }
 
 private:
     std::shared_ptr<Plato::DualOptimizer<ScalarType, OrdinalType>> mOptimizer;
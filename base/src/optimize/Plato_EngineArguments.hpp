@@ -0,0 +1,194 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_EngineArguments.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cassert>
+#include <algorithm>
+
+#include <Teuchos_ParameterList.hpp>
+
+#include "Plato_Vector.hpp"
+#include "Plato_Interface.hpp"
+#include "Plato_Exceptions.hpp"
+
+namespace Plato
+{
+
+/*!
+ * Arguments the engine criteria pass to Plato::Interface::compute.
+ *
+ * The argument list outlives a single stage: cache, output and update stages run later with
+ * whatever the list holds.  Inputs are therefore copied out of the optimizer's vector, so a
+ * later stage reads the control that was last evaluated even if the optimizer has since changed
+ * or freed its vector.  The copy goes straight into the shared data's send buffer when this
+ * rank has one of the right size, and the interface then transmits it without copying again;
+ * only the optimizer writes the send buffers of its inputs.  Otherwise the input is copied into
+ * a buffer owned here.  Outputs are written straight into the optimizer's storage, but only for
+ * the stage they were set for; afterwards they point at scratch storage owned here, so a later
+ * stage can't write into a vector the optimizer already got back.
+ **/
+template<typename ScalarType, typename OrdinalType = size_t>
+class EngineArguments
+{
+public:
+    explicit EngineArguments(const OrdinalType & aNumControls) :
+            mNumControls(aNumControls),
+            mScratchValue(0),
+            mScratchVector(aNumControls),
+            mInputs(),
+            mValueOutputs(),
+            mVectorOutputs(),
+            mParameterList(std::make_shared<Teuchos::ParameterList>())
+    {
+    }
+
+    //! Copy input vector into the send buffer of shared data aName, or into a buffer owned here
+    void setInput(Plato::Interface* aInterface, const std::string & aName, const Plato::Vector<ScalarType, OrdinalType> & aInput)
+    {
+        assert(aInterface != nullptr);
+        ScalarType* tBuffer = aInterface->getSendDataView(aName, aInput.size());
+        if(tBuffer == nullptr)
+        {
+            std::vector<ScalarType> & tOwnedBuffer = mInputs[aName];
+            tOwnedBuffer.resize(aInput.size());
+            tBuffer = tOwnedBuffer.data();
+        }
+        std::copy(aInput.data(), aInput.data() + aInput.size(), tBuffer);
+        mParameterList->set(aName, tBuffer);
+    }
+
+    //! Write argument aName to aOutput during the next stage
+    void setOutput(const std::string & aName, ScalarType* aOutput)
+    {
+        *aOutput = 0;
+        mParameterList->set(aName, aOutput);
+        mValueOutputs.push_back(aName);
+    }
+
+    //! Write argument aName to aOutput during the next stage
+    void setOutput(const std::string & aName, Plato::Vector<ScalarType, OrdinalType> & aOutput)
+    {
+        assert(aOutput.size() == mNumControls);
+        aOutput.fill(static_cast<ScalarType>(0));
+        mParameterList->set(aName, aOutput.data());
+        mVectorOutputs.push_back(aName);
+    }
+
+    //! Write argument aName to aOutput during the next stage
+    void setOutput(const std::string & aName, std::vector<ScalarType> & aOutput)
+    {
+        assert(aOutput.size() == mNumControls);
+        std::fill(aOutput.begin(), aOutput.end(), static_cast<ScalarType>(0));
+        mParameterList->set(aName, aOutput.data());
+        mVectorOutputs.push_back(aName);
+    }
+
+    /*!
+     * Stage handle for aStageName.  An empty name gives INVALID_STAGE; an unknown name is also
+     * registered with the interface, so the error is raised on every rank by the next stage.
+     **/
+    static int bindStage(Plato::Interface* aInterface, const std::string & aStageName)
+    {
+        assert(aInterface != nullptr);
+        if(aStageName.empty() == true)
+        {
+            return (Plato::INVALID_STAGE);
+        }
+        try
+        {
+            return (aInterface->bindStage(aStageName));
+        }
+        catch(const Plato::ParsingException & tParsingException)
+        {
+            aInterface->registerException(tParsingException);
+        }
+        return (Plato::INVALID_STAGE);
+    }
+    //! Run stage; outputs set since the last stage are released afterwards
+    void compute(Plato::Interface* aInterface, int aStageHandle)
+    {
+        assert(aInterface != nullptr);
+        aInterface->compute(aStageHandle, *mParameterList);
+
+        for(const std::string & tName : mValueOutputs)
+        {
+            mParameterList->set(tName, &mScratchValue);
+        }
+        for(const std::string & tName : mVectorOutputs)
+        {
+            mParameterList->set(tName, mScratchVector.data());
+        }
+        mValueOutputs.clear();
+        mVectorOutputs.clear();
+    }
+
+    Teuchos::ParameterList & list()
+    {
+        return (*mParameterList);
+    }
+
+private:
+    OrdinalType mNumControls;
+    ScalarType mScratchValue;
+    std::vector<ScalarType> mScratchVector;
+    std::map<std::string, std::vector<ScalarType>> mInputs;
+    std::vector<std::string> mValueOutputs;
+    std::vector<std::string> mVectorOutputs;
+    std::shared_ptr<Teuchos::ParameterList> mParameterList;
+
+private:
+    EngineArguments(const Plato::EngineArguments<ScalarType, OrdinalType>&);
+    Plato::EngineArguments<ScalarType, OrdinalType> & operator=(const Plato::EngineArguments<ScalarType, OrdinalType>&);
+}; // class EngineArguments
+
+} // namespace Plato
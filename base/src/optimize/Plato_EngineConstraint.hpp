@@ -58,6 +58,8 @@
 #include "Plato_Criterion.hpp"
 #include "Plato_MultiVector.hpp"
 #include "Plato_DataFactory.hpp"
+#include "Plato_EngineArguments.hpp"
+#include "Plato_EvaluationCache.hpp"
 #include "Plato_DistributedVector.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 
@@ -73,14 +75,20 @@ public:
                               const Plato::OptimizerEngineStageData & aInputData,
                               Plato::Interface* aInterface = nullptr) :
             mMyConstraintID(aConstraintID),
-            mVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mControl(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mGradient(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mHessianTimesVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
+            mNumControls(aDataFactory.getNumControls()),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mArguments(aDataFactory.getNumControls()),
+            mEvaluationCache(aInputData.getEvaluationCacheSize(),
+                             aInputData.getCacheStageName().empty() == false || aInputData.getUpdateProblemStageName().empty() == false),
+            mValueStage(Plato::INVALID_STAGE),
+            mGradientStage(Plato::INVALID_STAGE),
+            mHessianStage(Plato::INVALID_STAGE)
     {
+        if(mInterface != nullptr)
+        {
+            this->bindStages();
+        }
     }
     virtual ~EngineConstraint()
     {
@@ -93,12 +101,19 @@ public:
     {
         assert(aInterface != nullptr);
         mInterface = aInterface;
+        this->bindStages();
     }
     //! Directive to cache any criterion specific data once trial control is accepted.
     void cacheData()
     {
         return;
     }
+    //! Directive to update problem criterion.
+    void updateProblem()
+    {
+        // cached evaluations belong to the problem before the update
+        mEvaluationCache.clear();
+    }
     /*!
      * Evaluates criterion of type f(\mathbf{u}(\mathbf{z}),\mathbf{z})\colon\mathbb{R}^{n_u}\times\mathbb{R}^{n_z}
      * \rightarrow\mathbb{R}, where u denotes the state and z denotes the control variables. This criterion
@@ -112,27 +127,27 @@ public:
      **/
     ScalarType value(const Plato::MultiVector<ScalarType, OrdinalType> & aControl)
     {
-        // ********* Set view to each control vector entry ********* //
-        const OrdinalType tControlVectorIndex = 0;
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
+        // ********* Return the cached output if this control was evaluated recently ********* //
+        const std::string tMyStageName = mEngineInputData.getConstraintValueStageName(mMyConstraintID);
+        assert(tMyStageName.empty() == false);
+        ScalarType tCachedValue = 0;
+        if(mEvaluationCache.findValue(this->getLocalComm(), tMyStageName, aControl[0], tCachedValue, this->getEngineState()))
         {
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
+            return (tCachedValue);
         }
+
+        // ********* Set each control vector entry ********* //
+        const OrdinalType tControlVectorIndex = 0;
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
 
         // ********* Set view to objective function value ********* //
         ScalarType tConstraintValue = 0;
         std::string tMyConstraintName = mEngineInputData.getConstraintValueName(mMyConstraintID);
-        mParameterList->set(tMyConstraintName, &tConstraintValue);
+        mArguments.setOutput(tMyConstraintName, &tConstraintValue);
 
         // ********* Compute constraint value ********* //
-        std::string tMyStageName = mEngineInputData.getConstraintValueStageName(mMyConstraintID);
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
+        mArguments.compute(mInterface, mValueStage);
 
         const ScalarType tConstraintTarget = mEngineInputData.getConstraintNormalizedTargetValue(mMyConstraintID);
         const ScalarType tConstraintReferenceValue = mEngineInputData.getConstraintReferenceValue(mMyConstraintID);
@@ -143,6 +158,7 @@ public:
         // RESIDUAL AND THUS WE NEED TO DO THE FOLLOWING CALCULATION:
         ScalarType tOutput = (tConstraintValue / tConstraintReferenceValue) - tConstraintTarget;
 
+        mEvaluationCache.storeValue(tMyStageName, aControl[0], tOutput, this->getEngineState());
         return (tOutput);
     }
     /*!
@@ -159,31 +175,30 @@ public:
     void gradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                   Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
-        // ********* Set view to each control vector entry ********* //
-        const OrdinalType tControlVectorIndex = 0;
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
+        // ********* Return the cached output if this control was evaluated recently ********* //
+        const std::string tMyStageName = mEngineInputData.getConstraintGradientStageName(mMyConstraintID);
+        assert(tMyStageName.empty() == false);
+        if(mEvaluationCache.findVector(this->getLocalComm(), tMyStageName, aControl[0], aOutput[0], this->getEngineState()))
         {
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
+            return;
         }
+
+        // ********* Set each control vector entry ********* //
+        const OrdinalType tControlVectorIndex = 0;
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
 
         // ********* Set view to each output vector ********* //
         std::string tConstraintGradientName = mEngineInputData.getConstraintGradientName(mMyConstraintID);
-        std::fill(mGradient.begin(), mGradient.end(), static_cast<ScalarType>(0));
-        mParameterList->set(tConstraintGradientName, mGradient.data());
+        const OrdinalType tOutputVectorIndex = 0;
+        mArguments.setOutput(tConstraintGradientName, aOutput[tOutputVectorIndex]);
 
         // ********* Compute constraint gradient ********* //
-        std::string tMyStageName = mEngineInputData.getConstraintGradientStageName(mMyConstraintID);
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
-        this->copy(mGradient, aOutput);
+        mArguments.compute(mInterface, mGradientStage);
 
         const ScalarType tConstraintReferenceValue = mEngineInputData.getConstraintReferenceValue(mMyConstraintID);
         Plato::scale(static_cast<ScalarType>(1. / tConstraintReferenceValue), aOutput);
+        mEvaluationCache.storeVector(tMyStageName, aControl[0], aOutput[0], this->getEngineState());
     }
     /*!
      * Computes the application of a vector to the Hessian of a criterion of type f(\mathbf{u}(\mathbf{z}),\mathbf{z})
@@ -202,61 +217,67 @@ public:
                  const Plato::MultiVector<ScalarType, OrdinalType> & aVector,
                  Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
-        // ********* Set view to each control and descent direction vector entry ********* //
+        // ********* Set each control and descent direction vector entry ********* //
         const OrdinalType tControlVectorIndex = 0;
-        assert(mVector.size() == mControl.size());
-        assert(aVector[tControlVectorIndex].size() == mVector.size());
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
-        {
-            mVector[tControlIndex] = aVector(tControlVectorIndex, tControlIndex);
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
-        }
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
         std::string tDescentDirectionlName = mEngineInputData.getDescentDirectionName(tControlVectorIndex);
-        mParameterList->set(tDescentDirectionlName, mVector.data());
+        mArguments.setInput(mInterface, tDescentDirectionlName, aVector[tControlVectorIndex]);
 
         // ********* Set view to each output vector ********* //
         std::string tHessianName = mEngineInputData.getConstraintHessianName(mMyConstraintID);
-        std::fill(mHessianTimesVector.begin(), mHessianTimesVector.end(), static_cast<ScalarType>(0));
-        mParameterList->set(tHessianName, mHessianTimesVector.data());
+        const OrdinalType tOutputVectorIndex = 0;
+        mArguments.setOutput(tHessianName, aOutput[tOutputVectorIndex]);
 
         // ********* Apply vector to Hessian operator ********* //
-        std::string tMyStageName = mEngineInputData.getConstraintHessianStageName(mMyConstraintID);
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
-        this->copy(mHessianTimesVector, aOutput);
+        // not every constraint defines a Hessian stage, so it is bound on first use
+        if(mHessianStage == Plato::INVALID_STAGE)
+        {
+            const std::string tMyStageName = mEngineInputData.getConstraintHessianStageName(mMyConstraintID);
+            assert(tMyStageName.empty() == false);
+            mHessianStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, tMyStageName);
+        }
+        mArguments.compute(mInterface, mHessianStage);
 
         const ScalarType tConstraintReferenceValue = mEngineInputData.getConstraintReferenceValue(mMyConstraintID);
         Plato::scale(static_cast<ScalarType>(1. / tConstraintReferenceValue), aOutput);
     }
 
 private:
-    void copy(const std::vector<ScalarType> & aFrom, Plato::MultiVector<ScalarType, OrdinalType> & aTo)
+    //! Resolve the stage names once; the criterion then runs stages by handle
+    void bindStages()
     {
-        const OrdinalType tVectorIndex = 0;
-        Plato::Vector<ScalarType, OrdinalType> & tToVector = aTo[tVectorIndex];
-        assert(tToVector.size() == aFrom.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < aFrom.size(); tControlIndex++)
-        {
-            tToVector[tControlIndex] = aFrom[tControlIndex];
-        }
+        mValueStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getConstraintValueStageName(mMyConstraintID));
+        mGradientStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getConstraintGradientStageName(mMyConstraintID));
+        mHessianStage = Plato::INVALID_STAGE;
+    }
+
+    MPI_Comm getLocalComm()
+    {
+        MPI_Comm tLocalComm;
+        mInterface->getLocalComm(tLocalComm);
+        return (tLocalComm);
+    }
+
+    //! Performer state stamp for the evaluation cache; changes whenever any stage runs
+    size_t getEngineState() const
+    {
+        return (mInterface->getNumStageComputes());
     }
 
 private:
     OrdinalType mMyConstraintID;
 
-    std::vector<ScalarType> mVector;
-    std::vector<ScalarType> mControl;
-    std::vector<ScalarType> mGradient;
-    std::vector<ScalarType> mHessianTimesVector;
+    OrdinalType mNumControls;
 
     Plato::Interface* mInterface;
     Plato::OptimizerEngineStageData mEngineInputData;
-    std::shared_ptr<Teuchos::ParameterList> mParameterList;
+    Plato::EngineArguments<ScalarType, OrdinalType> mArguments;
+    Plato::EvaluationCache<ScalarType, OrdinalType> mEvaluationCache;
+
+    int mValueStage;
+    int mGradientStage;
+    int mHessianStage;
 
 private:
     EngineConstraint(const Plato::EngineConstraint<ScalarType, OrdinalType>&);
@@ -50,6 +50,7 @@
 #define PLATO_ENGINEOBJECTIVE_HPP_
 
 #include <vector>
+#include <algorithm>
 #include <string>
 #include <memory>
 #include <cassert>
@@ -57,7 +58,10 @@
 #include "Plato_Interface.hpp"
 #include "Plato_Criterion.hpp"
 #include "Plato_DataFactory.hpp"
+#include "Plato_EngineArguments.hpp"
+#include "Plato_EvaluationCache.hpp"
 #include "Plato_MultiVector.hpp"
+#include "Plato_MultiVectorList.hpp"
 #include "Plato_DistributedVector.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 
@@ -71,14 +75,29 @@ public:
     explicit EngineObjective(const Plato::DataFactory<ScalarType, OrdinalType> & aDataFactory,
                              const Plato::OptimizerEngineStageData & aInputData,
                              Plato::Interface* aInterface = nullptr) :
-            mVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mControl(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mGradient(std::vector<ScalarType>(aDataFactory.getNumControls())),
-            mHessianTimesVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
+            mNumControls(aDataFactory.getNumControls()),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mArguments(aDataFactory.getNumControls()),
+            mEvaluationCache(aInputData.getEvaluationCacheSize(),
+                             aInputData.getCacheStageName().empty() == false || aInputData.getUpdateProblemStageName().empty() == false),
+            mBatchSize(aInputData.getObjectiveBatchSize()),
+            mBatchValues(aInputData.getObjectiveBatchSize()),
+            mBatchGradients(aInputData.getObjectiveBatchSize(), std::vector<ScalarType>(aDataFactory.getNumControls())),
+            mCacheStage(Plato::INVALID_STAGE),
+            mOutputStage(Plato::INVALID_STAGE),
+            mUpdateProblemStage(Plato::INVALID_STAGE),
+            mValueStage(Plato::INVALID_STAGE),
+            mGradientStage(Plato::INVALID_STAGE),
+            mValueAndGradientStage(Plato::INVALID_STAGE),
+            mBatchValueStage(Plato::INVALID_STAGE),
+            mBatchGradientStage(Plato::INVALID_STAGE),
+            mHessianStage(Plato::INVALID_STAGE)
     {
+        if(mInterface != nullptr)
+        {
+            this->bindStages();
+        }
     }
     virtual ~EngineObjective()
     {
@@ -91,6 +110,7 @@ public:
     {
         assert(aInterface != nullptr);
         mInterface = aInterface;
+        this->bindStages();
     }
 
     //! Directive to cache any criterion specific data once trial control is accepted.
@@ -99,21 +119,17 @@ public:
         assert(mInterface != nullptr);
 
         // Tell performers to cache the state
-        std::vector<std::string> tStageNames;
         std::string tCacheStageName = mEngineInputData.getCacheStageName();
         if(tCacheStageName.empty() == false)
         {
-            tStageNames.push_back(tCacheStageName);
-            mInterface->compute(tStageNames, *mParameterList);
+            mArguments.compute(mInterface, mCacheStage);
         }
 
         // Temporarily putting output here.
-        tStageNames.clear();
         std::string tOutputStageName = mEngineInputData.getOutputStageName();
         if(tOutputStageName.empty() == false)
         {
-            tStageNames.push_back(tOutputStageName);
-            mInterface->compute(tStageNames, *mParameterList);
+            mArguments.compute(mInterface, mOutputStage);
         }
     }
 
@@ -122,13 +138,14 @@ public:
     {
         assert(mInterface != nullptr);
 
+        // cached evaluations belong to the problem before the update
+        mEvaluationCache.clear();
+
         // Tell performers to cache the state
-        std::vector<std::string> tStageNames;
         std::string tUpdateProblemName = mEngineInputData.getUpdateProblemStageName();
         if(tUpdateProblemName.empty() == false)
         {
-            tStageNames.push_back(tUpdateProblemName);
-            mInterface->compute(tStageNames, *mParameterList);
+            mArguments.compute(mInterface, mUpdateProblemStage);
         }
     }
 
@@ -146,28 +163,29 @@ public:
     ScalarType value(const Plato::MultiVector<ScalarType, OrdinalType> & aControl)
     {
         assert(mInterface != nullptr);
-        // ********* Set view to each control vector entry ********* //
-        const OrdinalType tControlVectorIndex = 0;
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
+        // ********* Return the cached output if this control was evaluated recently ********* //
+        const std::string tMyStageName = mEngineInputData.getObjectiveValueStageName();
+        assert(tMyStageName.empty() == false);
+        ScalarType tCachedValue = 0;
+        if(mEvaluationCache.findValue(this->getLocalComm(), tMyStageName, aControl[0], tCachedValue, this->getEngineState()))
         {
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
+            return (tCachedValue);
         }
+
+        // ********* Set each control vector entry ********* //
+        const OrdinalType tControlVectorIndex = 0;
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
 
         // ********* Set view to objective function value ********* //
         ScalarType tObjectiveValue = 0;
         std::string tValueOutputName = mEngineInputData.getObjectiveValueOutputName();
-        mParameterList->set(tValueOutputName, &tObjectiveValue);
+        mArguments.setOutput(tValueOutputName, &tObjectiveValue);
 
         // ********* Compute objective function value ********* //
-        std::string tMyStageName = mEngineInputData.getObjectiveValueStageName();
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
+        mArguments.compute(mInterface, mValueStage);
 
+        mEvaluationCache.storeValue(tMyStageName, aControl[0], tObjectiveValue, this->getEngineState());
         return (tObjectiveValue);
     }
     /*!
@@ -185,28 +203,196 @@ public:
                   Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
         assert(mInterface != nullptr);
-        // ********* Set view to each control vector entry ********* //
-        const OrdinalType tControlVectorIndex = 0;
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
+        // ********* Return the cached output if this control was evaluated recently ********* //
+        const std::string tMyStageName = mEngineInputData.getObjectiveGradientStageName();
+        assert(tMyStageName.empty() == false);
+        if(mEvaluationCache.findVector(this->getLocalComm(), tMyStageName, aControl[0], aOutput[0], this->getEngineState()))
         {
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
+            return;
         }
+
+        // ********* Set each control vector entry ********* //
+        const OrdinalType tControlVectorIndex = 0;
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
 
         // ********* Set view to each output vector ********* //
         std::string tGradientOutputName = mEngineInputData.getObjectiveGradientOutputName();
-        std::fill(mGradient.begin(), mGradient.end(), static_cast<ScalarType>(0));
-        mParameterList->set(tGradientOutputName, mGradient.data());
+        const OrdinalType tOutputVectorIndex = 0;
+        mArguments.setOutput(tGradientOutputName, aOutput[tOutputVectorIndex]);
 
         // ********* Compute objective function gradient ********* //
-        std::string tMyStageName = mEngineInputData.getObjectiveGradientStageName();
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
-        this->copy(mGradient, aOutput);
+        mArguments.compute(mInterface, mGradientStage);
+        mEvaluationCache.storeVector(tMyStageName, aControl[0], aOutput[0], this->getEngineState());
+    }
+    /*!
+     * Evaluates the criterion and computes its gradient at the same control. If the input file defines a
+     * combined value and gradient stage, both outputs are computed by a single stage; otherwise, the value
+     * and gradient stages are run one after the other.
+     *  Parameters:
+     *    \param In
+     *          aControl: control variables (i.e. design variables)
+     *    \param Out
+     *          aOutput: gradient
+     *
+     *  \return Objective function value
+     **/
+    ScalarType valueAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        assert(mInterface != nullptr);
+        const std::string tMyStageName = mEngineInputData.getObjectiveValueAndGradientStageName();
+        if(tMyStageName.empty() == true)
+        {
+            return (Plato::Criterion<ScalarType, OrdinalType>::valueAndGradient(aControl, aOutput));
+        }
+
+        // ********* Return the cached outputs if this control was evaluated recently ********* //
+        const std::string tValueStageName = mEngineInputData.getObjectiveValueStageName();
+        const std::string tGradientStageName = mEngineInputData.getObjectiveGradientStageName();
+        ScalarType tObjectiveValue = 0;
+        bool tFoundValue = mEvaluationCache.findValue(this->getLocalComm(), tValueStageName, aControl[0], tObjectiveValue, this->getEngineState());
+        bool tFoundGradient = mEvaluationCache.findVector(this->getLocalComm(), tGradientStageName, aControl[0], aOutput[0], this->getEngineState());
+        if(tFoundValue && tFoundGradient)
+        {
+            return (tObjectiveValue);
+        }
+
+        // ********* Set each control vector entry ********* //
+        const OrdinalType tControlVectorIndex = 0;
+        std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
+
+        // ********* Set view to objective function value and gradient ********* //
+        std::string tValueOutputName = mEngineInputData.getObjectiveValueOutputName();
+        mArguments.setOutput(tValueOutputName, &tObjectiveValue);
+        std::string tGradientOutputName = mEngineInputData.getObjectiveGradientOutputName();
+        const OrdinalType tOutputVectorIndex = 0;
+        mArguments.setOutput(tGradientOutputName, aOutput[tOutputVectorIndex]);
+
+        // ********* Compute objective function value and gradient ********* //
+        mArguments.compute(mInterface, mValueAndGradientStage);
+
+        mEvaluationCache.storeValue(tValueStageName, aControl[0], tObjectiveValue, this->getEngineState());
+        mEvaluationCache.storeVector(tGradientStageName, aControl[0], aOutput[0], this->getEngineState());
+        return (tObjectiveValue);
+    }
+    //! True if the input file defines a combined value and gradient stage
+    bool hasFusedValueAndGradient() const
+    {
+        return (mEngineInputData.getObjectiveValueAndGradientStageName().empty() == false);
+    }
+    /*!
+     * Evaluates the criterion at a batch of controls. If the input file defines a batch value stage, the
+     * controls that are not in the evaluation cache are evaluated BatchSize at a time by that stage;
+     * otherwise, they are evaluated one at a time.
+     *  Parameters:
+     *    \param In
+     *          aControls: list of control variables (i.e. design variables)
+     *    \param Out
+     *          aOutput: objective function value at each control
+     **/
+    void values(const Plato::MultiVectorList<ScalarType, OrdinalType> & aControls, std::vector<ScalarType> & aOutput)
+    {
+        assert(mInterface != nullptr);
+        const std::string tBatchStageName = mEngineInputData.getObjectiveBatchValueStageName();
+        if(tBatchStageName.empty() == true)
+        {
+            Plato::Criterion<ScalarType, OrdinalType>::values(aControls, aOutput);
+            return;
+        }
+
+        // ********* Return the cached outputs of controls evaluated recently ********* //
+        const std::string tValueStageName = mEngineInputData.getObjectiveValueStageName();
+        aOutput.resize(aControls.size());
+        std::vector<OrdinalType> tEvaluate;
+        for(OrdinalType tIndex = 0; tIndex < aControls.size(); tIndex++)
+        {
+            if(mEvaluationCache.findValue(this->getLocalComm(), tValueStageName, aControls[tIndex][0], aOutput[tIndex], this->getEngineState()) == false)
+            {
+                tEvaluate.push_back(tIndex);
+            }
+        }
+
+        // ********* Compute objective function values one batch at a time ********* //
+        const OrdinalType tBatchSize = mBatchSize;
+        const OrdinalType tNumEvaluate = tEvaluate.size();
+        std::string tValueOutputName = mEngineInputData.getObjectiveValueOutputName();
+        for(OrdinalType tBegin = 0; tBegin < tNumEvaluate; tBegin += tBatchSize)
+        {
+            this->setBatchControls(aControls, tEvaluate, tBegin);
+            for(OrdinalType tColumn = 0; tColumn < tBatchSize; tColumn++)
+            {
+                mArguments.setOutput(Plato::batch_argument_name(tValueOutputName, tColumn), &mBatchValues[tColumn]);
+            }
+            mArguments.compute(mInterface, mBatchValueStage);
+
+            const OrdinalType tEnd = std::min(tBegin + tBatchSize, tNumEvaluate);
+            for(OrdinalType tIndex = tBegin; tIndex < tEnd; tIndex++)
+            {
+                const OrdinalType tControlIndex = tEvaluate[tIndex];
+                aOutput[tControlIndex] = mBatchValues[tIndex - tBegin];
+                this->storeBatchValue(tValueStageName, aControls[tControlIndex][0], aOutput[tControlIndex]);
+            }
+        }
+    }
+    /*!
+     * Computes the gradient of the criterion at a batch of controls. If the input file defines a batch gradient
+     * stage, the controls that are not in the evaluation cache are evaluated BatchSize at a time by that stage;
+     * otherwise, the gradients are computed one at a time.
+     *  Parameters:
+     *    \param In
+     *          aControls: list of control variables (i.e. design variables)
+     *    \param Out
+     *          aOutput: gradient at each control
+     **/
+    void gradients(const Plato::MultiVectorList<ScalarType, OrdinalType> & aControls,
+                   Plato::MultiVectorList<ScalarType, OrdinalType> & aOutput)
+    {
+        assert(mInterface != nullptr);
+        const std::string tBatchStageName = mEngineInputData.getObjectiveBatchGradientStageName();
+        if(tBatchStageName.empty() == true)
+        {
+            Plato::Criterion<ScalarType, OrdinalType>::gradients(aControls, aOutput);
+            return;
+        }
+
+        // ********* Return the cached outputs of controls evaluated recently ********* //
+        assert(aControls.size() == aOutput.size());
+        const std::string tGradientStageName = mEngineInputData.getObjectiveGradientStageName();
+        std::vector<OrdinalType> tEvaluate;
+        for(OrdinalType tIndex = 0; tIndex < aControls.size(); tIndex++)
+        {
+            if(mEvaluationCache.findVector(this->getLocalComm(), tGradientStageName, aControls[tIndex][0], aOutput[tIndex][0], this->getEngineState()) == false)
+            {
+                tEvaluate.push_back(tIndex);
+            }
+        }
+
+        // ********* Compute objective function gradients one batch at a time ********* //
+        const OrdinalType tBatchSize = mBatchSize;
+        const OrdinalType tNumEvaluate = tEvaluate.size();
+        std::string tGradientOutputName = mEngineInputData.getObjectiveGradientOutputName();
+        for(OrdinalType tBegin = 0; tBegin < tNumEvaluate; tBegin += tBatchSize)
+        {
+            this->setBatchControls(aControls, tEvaluate, tBegin);
+            for(OrdinalType tColumn = 0; tColumn < tBatchSize; tColumn++)
+            {
+                mArguments.setOutput(Plato::batch_argument_name(tGradientOutputName, tColumn), mBatchGradients[tColumn]);
+            }
+            mArguments.compute(mInterface, mBatchGradientStage);
+
+            const OrdinalType tEnd = std::min(tBegin + tBatchSize, tNumEvaluate);
+            for(OrdinalType tIndex = tBegin; tIndex < tEnd; tIndex++)
+            {
+                const OrdinalType tControlIndex = tEvaluate[tIndex];
+                Plato::Vector<ScalarType, OrdinalType> & tOutput = aOutput[tControlIndex][0];
+                assert(tOutput.size() == mNumControls);
+                const std::vector<ScalarType> & tGradient = mBatchGradients[tIndex - tBegin];
+                std::copy(tGradient.begin(), tGradient.end(), tOutput.data());
+                this->storeBatchVector(tGradientStageName, aControls[tControlIndex][0], tOutput);
+            }
+        }
     }
     /*!
      * Computes the application of a vector to the Hessian of a criterion of type f(\mathbf{u}(\mathbf{z}),\mathbf{z})
@@ -226,56 +412,113 @@ public:
                  Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
     {
         assert(mInterface != nullptr);
-        // ********* Set view to each control and descent direction vector entry ********* //
+        // ********* Set each control and descent direction vector entry ********* //
         const OrdinalType tControlVectorIndex = 0;
-        assert(mVector.size() == mControl.size());
-        assert(aVector[tControlVectorIndex].size() == mVector.size());
-        assert(aControl[tControlVectorIndex].size() == mControl.size());
-        for(OrdinalType tControlIndex = 0; tControlIndex < mControl.size(); tControlIndex++)
-        {
-            mVector[tControlIndex] = aVector(tControlVectorIndex, tControlIndex);
-            mControl[tControlIndex] = aControl(tControlVectorIndex, tControlIndex);
-        }
         std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
-        mParameterList->set(tControlName, mControl.data());
+        mArguments.setInput(mInterface, tControlName, aControl[tControlVectorIndex]);
         std::string tDescentDirectionlName = mEngineInputData.getDescentDirectionName(tControlVectorIndex);
-        mParameterList->set(tDescentDirectionlName, mVector.data());
+        mArguments.setInput(mInterface, tDescentDirectionlName, aVector[tControlVectorIndex]);
 
         // ********* Set view to each output vector ********* //
         std::string tHessianOutputName = mEngineInputData.getObjectiveHessianOutputName();
-        std::fill(mHessianTimesVector.begin(), mHessianTimesVector.end(), static_cast<ScalarType>(0));
-        mParameterList->set(tHessianOutputName, mHessianTimesVector.data());
+        const OrdinalType tOutputVectorIndex = 0;
+        mArguments.setOutput(tHessianOutputName, aOutput[tOutputVectorIndex]);
 
         // ********* Apply vector to Hessian operator ********* //
-        std::string tMyStageName = mEngineInputData.getObjectiveHessianStageName();
-        assert(tMyStageName.empty() == false);
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
-        this->copy(mHessianTimesVector, aOutput);
+        assert(mEngineInputData.getObjectiveHessianStageName().empty() == false);
+        mArguments.compute(mInterface, mHessianStage);
     }
 
 private:
-    void copy(const std::vector<ScalarType> & aFrom, Plato::MultiVector<ScalarType, OrdinalType> & aTo)
+    //! Resolve the stage names once; the criterion then runs stages by handle
+    void bindStages()
     {
-        const OrdinalType tVectorIndex = 0;
-        Plato::Vector<ScalarType, OrdinalType> & tToVector = aTo[tVectorIndex];
-        assert(tToVector.size() == aFrom.size());
-        for(OrdinalType tIndex = 0; tIndex < aFrom.size(); tIndex++)
+        mCacheStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getCacheStageName());
+        mOutputStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getOutputStageName());
+        mUpdateProblemStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getUpdateProblemStageName());
+        mValueStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveValueStageName());
+        mGradientStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveGradientStageName());
+        mValueAndGradientStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveValueAndGradientStageName());
+        mBatchValueStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveBatchValueStageName());
+        mBatchGradientStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveBatchGradientStageName());
+        mHessianStage = Plato::EngineArguments<ScalarType, OrdinalType>::bindStage(mInterface, mEngineInputData.getObjectiveHessianStageName());
+    }
+
+    MPI_Comm getLocalComm()
+    {
+        MPI_Comm tLocalComm;
+        mInterface->getLocalComm(tLocalComm);
+        return (tLocalComm);
+    }
+
+    //! Performer state stamp for the evaluation cache; changes whenever any stage runs
+    size_t getEngineState() const
+    {
+        return (mInterface->getNumStageComputes());
+    }
+
+    /*!
+     * Cache outputs of a batch stage.  After a batch the performers don't hold the state of any one
+     * control, so a stateful cache doesn't keep them.
+     **/
+    void storeBatchValue(const std::string & aStageName,
+                         const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                         const ScalarType & aValue)
+    {
+        if(mEvaluationCache.isStateful() == false)
+        {
+            mEvaluationCache.storeValue(aStageName, aControl, aValue);
+        }
+    }
+    void storeBatchVector(const std::string & aStageName,
+                          const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                          const Plato::Vector<ScalarType, OrdinalType> & aOutput)
+    {
+        if(mEvaluationCache.isStateful() == false)
         {
-            tToVector[tIndex] = aFrom[tIndex];
+            mEvaluationCache.storeVector(aStageName, aControl, aOutput);
+        }
+    }
+
+    /*!
+     * Set the batch stage control arguments to the controls aIndices[aBegin], aIndices[aBegin + 1], ...
+     * A partial last batch repeats its last control, so every column holds a valid control.
+     **/
+    void setBatchControls(const Plato::MultiVectorList<ScalarType, OrdinalType> & aControls,
+                          const std::vector<OrdinalType> & aIndices,
+                          const OrdinalType & aBegin)
+    {
+        const OrdinalType tControlVectorIndex = 0;
+        std::string tControlName = mEngineInputData.getControlName(tControlVectorIndex);
+        const OrdinalType tLast = aIndices.size() - 1;
+        for(OrdinalType tColumn = 0; tColumn < mBatchSize; tColumn++)
+        {
+            const OrdinalType tControlIndex = aIndices[std::min(aBegin + tColumn, tLast)];
+            mArguments.setInput(mInterface, Plato::batch_argument_name(tControlName, tColumn), aControls[tControlIndex][tControlVectorIndex]);
         }
     }
 
 private:
-    std::vector<ScalarType> mVector;
-    std::vector<ScalarType> mControl;
-    std::vector<ScalarType> mGradient;
-    std::vector<ScalarType> mHessianTimesVector;
+    OrdinalType mNumControls;
 
     Plato::Interface* mInterface;
     Plato::OptimizerEngineStageData mEngineInputData;
-    std::shared_ptr<Teuchos::ParameterList> mParameterList;
+    Plato::EngineArguments<ScalarType, OrdinalType> mArguments;
+    Plato::EvaluationCache<ScalarType, OrdinalType> mEvaluationCache;
+
+    OrdinalType mBatchSize;
+    std::vector<ScalarType> mBatchValues;
+    std::vector<std::vector<ScalarType>> mBatchGradients;
+
+    int mCacheStage;
+    int mOutputStage;
+    int mUpdateProblemStage;
+    int mValueStage;
+    int mGradientStage;
+    int mValueAndGradientStage;
+    int mBatchValueStage;
+    int mBatchGradientStage;
+    int mHessianStage;
 
 private:
     EngineObjective(const Plato::EngineObjective<ScalarType, OrdinalType>&);
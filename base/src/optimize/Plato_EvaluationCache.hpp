@@ -0,0 +1,351 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_EvaluationCache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include <mpi.h>
+
+#include <list>
+#include <cassert>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "Plato_Vector.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Keeps the outputs of the most recent stage evaluations, keyed on stage
+ * name and control vector, so repeated evaluations at the same control skip the
+ * engine.  Lookups are collective over the communicator: an entry only counts as
+ * a hit if every rank's local part of the control matches, so all ranks agree on
+ * whether to call the engine.
+ *
+ * A stateful cache is for performers that keep state from the last stage they ran
+ * (e.g. the solution a cache or gradient stage reuses).  Each entry is stamped with
+ * the engine state it was computed in, and only matches while the engine is still in
+ * that state, so a hit never leaves the performers at a different control than the
+ * one the optimizer asked for.
+ **********************************************************************************/
+template<typename ScalarType, typename OrdinalType = size_t>
+class EvaluationCache
+{
+public:
+    /******************************************************************************//**
+     * @brief Constructor
+     * @param [in] aCapacity maximum number of evaluations kept; zero disables the cache
+     * @param [in] aStateful only match entries computed in the current engine state
+     **********************************************************************************/
+    explicit EvaluationCache(const size_t & aCapacity, const bool & aStateful = false) :
+            mCapacity(aCapacity),
+            mStateful(aStateful),
+            mNumHits(0),
+            mNumMisses(0),
+            mEntries()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Destructor
+     **********************************************************************************/
+    ~EvaluationCache()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Indicates if evaluations are cached
+     * @return true/false flag
+     **********************************************************************************/
+    bool isEnabled() const
+    {
+        return (mCapacity > static_cast<size_t>(0));
+    }
+
+    /******************************************************************************//**
+     * @brief Indicates if entries only match in the engine state they were computed in
+     * @return true/false flag
+     **********************************************************************************/
+    bool isStateful() const
+    {
+        return (mStateful);
+    }
+
+    /******************************************************************************//**
+     * @brief Number of lookups that avoided an engine call
+     **********************************************************************************/
+    size_t getNumHits() const
+    {
+        return (mNumHits);
+    }
+
+    /******************************************************************************//**
+     * @brief Number of lookups that required an engine call
+     **********************************************************************************/
+    size_t getNumMisses() const
+    {
+        return (mNumMisses);
+    }
+
+    /******************************************************************************//**
+     * @brief Drop all cached evaluations, e.g. after the problem definition changes
+     **********************************************************************************/
+    void clear()
+    {
+        mEntries.clear();
+    }
+
+    /******************************************************************************//**
+     * @brief Look up a cached scalar output (collective)
+     * @param [in] aComm communicator shared by all ranks holding part of the control
+     * @param [in] aStageName stage that produced the output
+     * @param [in] aControl local part of the control vector
+     * @param [out] aValue cached output
+     * @param [in] aState current engine state (e.g. number of stages computed so far)
+     * @return true if the output was found on every rank
+     **********************************************************************************/
+    bool findValue(const MPI_Comm & aComm,
+                   const std::string & aStageName,
+                   const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                   ScalarType & aValue,
+                   const size_t & aState = 0)
+    {
+        typename std::list<Entry>::iterator tEntry = this->find(aComm, aStageName, aControl, aState);
+        if(tEntry == mEntries.end())
+        {
+            return (false);
+        }
+        aValue = tEntry->mValue;
+        return (true);
+    }
+
+    /******************************************************************************//**
+     * @brief Look up a cached vector output (collective)
+     * @param [in] aComm communicator shared by all ranks holding part of the control
+     * @param [in] aStageName stage that produced the output
+     * @param [in] aControl local part of the control vector
+     * @param [out] aOutput cached output
+     * @param [in] aState current engine state (e.g. number of stages computed so far)
+     * @return true if the output was found on every rank
+     **********************************************************************************/
+    bool findVector(const MPI_Comm & aComm,
+                    const std::string & aStageName,
+                    const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                    Plato::Vector<ScalarType, OrdinalType> & aOutput,
+                    const size_t & aState = 0)
+    {
+        typename std::list<Entry>::iterator tEntry = this->find(aComm, aStageName, aControl, aState);
+        if(tEntry == mEntries.end())
+        {
+            return (false);
+        }
+        assert(tEntry->mOutput.size() == aOutput.size());
+        std::copy(tEntry->mOutput.begin(), tEntry->mOutput.end(), aOutput.data());
+        return (true);
+    }
+
+    /******************************************************************************//**
+     * @brief Cache a scalar output
+     * @param [in] aStageName stage that produced the output
+     * @param [in] aControl local part of the control vector
+     * @param [in] aValue output
+     * @param [in] aState engine state after the stage ran
+     **********************************************************************************/
+    void storeValue(const std::string & aStageName,
+                    const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                    const ScalarType & aValue,
+                    const size_t & aState = 0)
+    {
+        if(this->isEnabled() == false)
+        {
+            return;
+        }
+        Entry & tEntry = this->insert(aStageName, aControl, aState);
+        tEntry.mValue = aValue;
+    }
+
+    /******************************************************************************//**
+     * @brief Cache a vector output
+     * @param [in] aStageName stage that produced the output
+     * @param [in] aControl local part of the control vector
+     * @param [in] aOutput output
+     * @param [in] aState engine state after the stage ran
+     **********************************************************************************/
+    void storeVector(const std::string & aStageName,
+                     const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                     const Plato::Vector<ScalarType, OrdinalType> & aOutput,
+                     const size_t & aState = 0)
+    {
+        if(this->isEnabled() == false)
+        {
+            return;
+        }
+        Entry & tEntry = this->insert(aStageName, aControl, aState);
+        tEntry.mOutput.assign(aOutput.data(), aOutput.data() + aOutput.size());
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t mHash;
+        std::string mStageName;
+        std::vector<ScalarType> mControl;
+        size_t mState;
+        ScalarType mValue;
+        std::vector<ScalarType> mOutput;
+    };
+
+    /******************************************************************************//**
+     * @brief FNV-1a hash of the stage name and the bytes of the local control
+     **********************************************************************************/
+    uint64_t hash(const std::string & aStageName, const Plato::Vector<ScalarType, OrdinalType> & aControl) const
+    {
+        uint64_t tHash = static_cast<uint64_t>(std::hash<std::string>()(aStageName));
+        const unsigned char* tBytes = reinterpret_cast<const unsigned char*>(aControl.data());
+        const size_t tNumBytes = aControl.size() * sizeof(ScalarType);
+        for(size_t tIndex = 0; tIndex < tNumBytes; tIndex++)
+        {
+            tHash ^= static_cast<uint64_t>(tBytes[tIndex]);
+            tHash *= static_cast<uint64_t>(1099511628211ULL);
+        }
+        return (tHash);
+    }
+
+    /******************************************************************************//**
+     * @brief Find the entry that matches on every rank; a hit moves it to the front
+     **********************************************************************************/
+    typename std::list<Entry>::iterator find(const MPI_Comm & aComm,
+                                             const std::string & aStageName,
+                                             const Plato::Vector<ScalarType, OrdinalType> & aControl,
+                                             const size_t & aState)
+    {
+        if(this->isEnabled() == false)
+        {
+            return (mEntries.end());
+        }
+
+        const uint64_t tHash = this->hash(aStageName, aControl);
+        typename std::list<Entry>::iterator tEntry = mEntries.begin();
+        for(; tEntry != mEntries.end(); ++tEntry)
+        {
+            // the hash only filters; the control is compared exactly
+            if(tEntry->mHash == tHash && tEntry->mStageName == aStageName && this->matches(tEntry->mControl, aControl)
+               && (mStateful == false || tEntry->mState == aState))
+            {
+                break;
+            }
+        }
+
+        int tLocalHit = (tEntry != mEntries.end()) ? 1 : 0;
+        int tGlobalHit = 0;
+        MPI_Allreduce(&tLocalHit, &tGlobalHit, 1, MPI_INT, MPI_MIN, aComm);
+        if(tGlobalHit == 0)
+        {
+            mNumMisses++;
+            return (mEntries.end());
+        }
+
+        mNumHits++;
+        mEntries.splice(mEntries.begin(), mEntries, tEntry);
+        return (mEntries.begin());
+    }
+
+    /******************************************************************************//**
+     * @brief Exact comparison of a cached control with the local part of a control
+     **********************************************************************************/
+    bool matches(const std::vector<ScalarType> & aCached, const Plato::Vector<ScalarType, OrdinalType> & aControl) const
+    {
+        return (aCached.size() == aControl.size()
+                && std::memcmp(aCached.data(), aControl.data(), aControl.size() * sizeof(ScalarType)) == 0);
+    }
+
+    /******************************************************************************//**
+     * @brief Add an entry at the front, evicting the least recently used entry if full
+     **********************************************************************************/
+    Entry & insert(const std::string & aStageName, const Plato::Vector<ScalarType, OrdinalType> & aControl, const size_t & aState)
+    {
+        // the engine is now at this control, so the other outputs computed there are current again
+        for(Entry & tCached : mEntries)
+        {
+            if(this->matches(tCached.mControl, aControl))
+            {
+                tCached.mState = aState;
+            }
+        }
+
+        Entry tEntry;
+        tEntry.mHash = this->hash(aStageName, aControl);
+        tEntry.mStageName = aStageName;
+        tEntry.mControl.assign(aControl.data(), aControl.data() + aControl.size());
+        tEntry.mState = aState;
+        tEntry.mValue = 0;
+        mEntries.push_front(tEntry);
+        while(mEntries.size() > mCapacity)
+        {
+            mEntries.pop_back();
+        }
+        return (mEntries.front());
+    }
+
+private:
+    size_t mCapacity;
+    bool mStateful;
+    size_t mNumHits;
+    size_t mNumMisses;
+    std::list<Entry> mEntries;
+
+private:
+    EvaluationCache(const Plato::EvaluationCache<ScalarType, OrdinalType>&);
+    Plato::EvaluationCache<ScalarType, OrdinalType> & operator=(const Plato::EvaluationCache<ScalarType, OrdinalType>&);
+};
+// class EvaluationCache
+
+} // namespace Plato
@@ -0,0 +1,117 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_FieldAggregation.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef PLATO_FIELDAGGREGATION_HPP_
+#define PLATO_FIELDAGGREGATION_HPP_
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "Plato_KokkosTypes.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Compute aOutput[i] = sum_j aWeights[j] * aInputs[j][i] in a single pass
+ * @param [in] aInputs host pointers to the input fields, each of length aLength
+ * @param [in] aWeights one weight per input (extra weights are ignored)
+ * @param [in] aLength number of entries in each field
+ * @param [out] aOutput host pointer to the output field
+ *
+ * The entries are split into blocks small enough that a block of the output stays
+ * in L1 cache while every input streams through it once.  Blocks are distributed
+ * over the host execution space.  Each output entry is summed in input order, so
+ * the result doesn't depend on the number of threads.
+**********************************************************************************/
+inline void aggregate(const std::vector<const double*> & aInputs,
+                      const std::vector<double> & aWeights,
+                      const int & aLength,
+                      double* aOutput)
+{
+    assert(aInputs.size() <= aWeights.size());
+    const int tNumInputs = aInputs.size();
+    if(tNumInputs == static_cast<int>(0))
+    {
+        std::fill(aOutput, aOutput + aLength, 0.0);
+        return;
+    }
+
+    const int tBlockSize = 1024;
+    const int tNumBlocks = (aLength + tBlockSize - 1) / tBlockSize;
+    const double* const * tInputs = aInputs.data();
+    const double* tWeights = aWeights.data();
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, tNumBlocks),
+                         [=](const int & aBlock)
+    {
+        const int tBegin = aBlock * tBlockSize;
+        const int tEnd = std::min(tBegin + tBlockSize, aLength);
+
+        const double tFirstWeight = tWeights[0];
+        const double* tFirstInput = tInputs[0];
+        for(int tIndex = tBegin; tIndex < tEnd; tIndex++)
+        {
+            aOutput[tIndex] = tFirstWeight * tFirstInput[tIndex];
+        }
+        for(int tInputIndex = 1; tInputIndex < tNumInputs; tInputIndex++)
+        {
+            const double tWeight = tWeights[tInputIndex];
+            const double* tInput = tInputs[tInputIndex];
+            for(int tIndex = tBegin; tIndex < tEnd; tIndex++)
+            {
+                aOutput[tIndex] += tWeight * tInput[tIndex];
+            }
+        }
+    }, "Plato::aggregate");
+    Kokkos::DefaultHostExecutionSpace().fence();
+}
+
+} // namespace Plato
+
+#endif /* PLATO_FIELDAGGREGATION_HPP_ */
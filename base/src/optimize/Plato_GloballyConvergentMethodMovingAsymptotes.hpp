@@ -283,6 +283,11 @@ public:
     {
         mDualSolver->initializeAuxiliaryVariables(aDataMng);
     }
+    void restoreAuxiliaryVariables(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng)
+    {
+        mDualSolver->initializeAuxiliaryVariables(aDataMng);
+        mDualSolver->setInitialGuess(aDataMng.getDual());
+    }
 
 private:
     void initialize()
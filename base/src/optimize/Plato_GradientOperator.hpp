@@ -56,6 +56,8 @@ template<typename ScalarType, typename OrdinalType>
 class StateData;
 template<typename ScalarType, typename OrdinalType>
 class MultiVector;
+template<typename ScalarType, typename OrdinalType>
+class Criterion;
 
 template<typename ScalarType, typename OrdinalType = size_t>
 class GradientOperator
@@ -68,6 +70,22 @@ public:
     virtual void update(const Plato::StateData<ScalarType, OrdinalType> & aStateData) = 0;
     virtual void compute(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                          Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
+
+    //! Evaluate criterion and compute its gradient at the same control. Operators built on the criterion's
+    //! analytical gradient override this method to request both quantities in a single evaluation.
+    virtual ScalarType computeWithValue(Plato::Criterion<ScalarType, OrdinalType> & aCriterion,
+                                        const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                        Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        const ScalarType tValue = aCriterion.value(aControl);
+        this->compute(aControl, aOutput);
+        return (tValue);
+    }
+    //! Indicates if computeWithValue evaluates criterion and gradient in a single evaluation
+    virtual bool hasFusedValueAndGradient(const Plato::Criterion<ScalarType, OrdinalType> & aCriterion) const
+    {
+        return (false);
+    }
 };
 
 } // namespace Plato
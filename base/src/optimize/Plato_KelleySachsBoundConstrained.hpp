@@ -55,6 +55,7 @@
 #include <cassert>
 #include <iostream>
 #include <algorithm>
+#include <functional>
 
 #include "Plato_Types.hpp"
 #include "Plato_ErrorChecks.hpp"
@@ -62,6 +63,7 @@
 #include "Plato_MultiVector.hpp"
 #include "Plato_OptimizersIO.hpp"
 #include "Plato_LinearAlgebra.hpp"
+#include "Plato_CheckpointUtilities.hpp"
 #include "Plato_KelleySachsStepMng.hpp"
 #include "Plato_TrustRegionStageMng.hpp"
 #include "Plato_KelleySachsAlgorithm.hpp"
@@ -86,7 +88,10 @@ public:
                                 const std::shared_ptr<Plato::TrustRegionStageMng<ScalarType, OrdinalType>> & aStageMng) :
             Plato::KelleySachsAlgorithm<ScalarType, OrdinalType>(*aDataFactory),
             mPrintDiagnostics(false),
+            mIsRestart(false),
             mOptimalityTolerance(1e-5),
+            mCheckpointFrequency(0),
+            mCheckpointFunction(),
             mOutputData(),
             mGradient(aDataFactory->control().create()),
             mControlWorkVector(aDataFactory->control().create()),
@@ -238,6 +243,42 @@ public:
         return (*mStageMng);
     }
 
+    /******************************************************************************//**
+     * @brief Call a function every aFrequency iterations, e.g. to write a checkpoint
+     * @param [in] aFrequency number of iterations between calls; zero disables the calls
+     * @param [in] aFunction function called after the iteration is done
+    **********************************************************************************/
+    void setCheckpointFunction(const OrdinalType & aFrequency, const std::function<void()> & aFunction)
+    {
+        mCheckpointFrequency = aFrequency;
+        mCheckpointFunction = aFunction;
+    }
+
+    /******************************************************************************//**
+     * @brief Write this rank's part of the algorithm state to a checkpoint
+     * @param [in,out] aWriter checkpoint writer
+    **********************************************************************************/
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+    {
+        Plato::write_checkpoint("ksbc/current_control", mDataMng->getCurrentControl(), aWriter);
+        aWriter.write("ksbc/trust_region_radius", static_cast<double>(mStepMng->getTrustRegionRadius()));
+        aWriter.write("ksbc/num_iterations", static_cast<double>(this->getNumIterationsDone()));
+    }
+
+    /******************************************************************************//**
+     * @brief Restore the algorithm state; solve() then continues from the checkpointed
+     *   control, trust region radius and iteration
+     * @param [in] aReader checkpoint reader
+    **********************************************************************************/
+    void readCheckpoint(const Plato::CheckpointReader & aReader)
+    {
+        Plato::read_checkpoint("ksbc/current_control", aReader, *mControlWorkVector);
+        mDataMng->setInitialGuess(*mControlWorkVector);
+        mStepMng->setTrustRegionRadius(aReader.read("ksbc/trust_region_radius"));
+        this->setNumIterationsDone(aReader.read("ksbc/num_iterations"));
+        mIsRestart = true;
+    }
+
     /******************************************************************************//**
      * @brief Solve bound constrained optimization problem
     **********************************************************************************/
@@ -249,7 +290,7 @@ public:
         mStageMng->updateOptimizationData(*mDataMng);
         this->outputDiagnostics();
 
-        OrdinalType tIteration = 0;
+        OrdinalType tIteration = mIsRestart ? this->getNumIterationsDone() : static_cast<OrdinalType>(0);
         while(1)
         {
             tIteration++;
@@ -271,6 +312,7 @@ public:
                 this->closeOutputFile();
                 break;
             }
+            this->conditionallyWriteCheckpoint();
         }
     }
 
@@ -310,6 +352,18 @@ public:
     }
 
 private:
+    /******************************************************************************//**
+     * @brief Call the checkpoint function if this iteration is a multiple of the checkpoint frequency.
+    **********************************************************************************/
+    void conditionallyWriteCheckpoint()
+    {
+        const bool tHaveCheckpointFrequency = mCheckpointFrequency > static_cast<OrdinalType>(0);
+        if(tHaveCheckpointFrequency && (this->getNumIterationsDone() % mCheckpointFrequency) == static_cast<OrdinalType>(0))
+        {
+            mCheckpointFunction();
+        }
+    }
+
     /******************************************************************************//**
      * @brief Open output file (i.e. diagnostics file)
     **********************************************************************************/
@@ -432,14 +486,30 @@ private:
         this->initializeMaxTrustRegionRadius(*mStepMng);
         const Plato::MultiVector<ScalarType, OrdinalType> & tCurrentControl = mDataMng->getCurrentControl();
         ScalarType tTolerance = mStepMng->getObjectiveInexactnessTolerance();
-        ScalarType tCurrentObjFuncValue = mStageMng->evaluateObjective(tCurrentControl, tTolerance);
+        ScalarType tCurrentObjFuncValue = 0;
+        const bool tFusedObjectiveAndGradient = mStageMng->hasFusedObjectiveAndGradient();
+        if(tFusedObjectiveAndGradient == true)
+        {
+            tCurrentObjFuncValue = mStageMng->evaluateObjectiveAndGradient(tCurrentControl, *mGradient, tTolerance);
+        }
+        else
+        {
+            tCurrentObjFuncValue = mStageMng->evaluateObjective(tCurrentControl, tTolerance);
+        }
         mDataMng->setCurrentObjectiveFunctionValue(tCurrentObjFuncValue);
         mStageMng->cacheData();
-        mStageMng->computeGradient(tCurrentControl, *mGradient);
+        if(tFusedObjectiveAndGradient == false)
+        {
+            mStageMng->computeGradient(tCurrentControl, *mGradient);
+        }
         mDataMng->setCurrentGradient(*mGradient);
         mDataMng->computeActiveAndInactiveSet();
         mDataMng->computeNormProjectedGradient();
-        this->initializeTrustRegionRadius(*mDataMng, *mStepMng);
+        // a restart keeps the checkpointed radius
+        if(mIsRestart == false)
+        {
+            this->initializeTrustRegionRadius(*mDataMng, *mStepMng);
+        }
         mDataMng->computeStationarityMeasure();
     }
 
@@ -584,9 +654,13 @@ private:
 
 private:
     bool mPrintDiagnostics;
+    bool mIsRestart;
     std::ofstream mOutputStream;
     ScalarType mOptimalityTolerance;
 
+    OrdinalType mCheckpointFrequency;
+    std::function<void()> mCheckpointFunction;
+
     Plato::OutputDataKSBC<ScalarType, OrdinalType> mOutputData;
 
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mGradient;
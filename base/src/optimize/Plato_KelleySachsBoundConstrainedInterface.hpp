@@ -60,6 +60,7 @@
 #include "Plato_AlgebraFactory.hpp"
 #include "Plato_EngineObjective.hpp"
 #include "Plato_OptimizerInterface.hpp"
+#include "Plato_OptimizerUtilities.hpp"
 #include "Plato_StandardMultiVector.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 #include "Plato_KelleySachsBoundConstrained.hpp"
@@ -160,6 +161,7 @@ public:
         Plato::KelleySachsBoundConstrained<ScalarType, OrdinalType> tAlgorithm(tDataFactory, tDataMng, tStageMng);
         this->setParameters(tAlgorithm);
         tAlgorithm.enableDiagnostics();
+        Plato::setCheckpointAndRestart(mInterface, mInputData, mComm, tAlgorithm);
         tAlgorithm.solve();
 
         this->finalize();
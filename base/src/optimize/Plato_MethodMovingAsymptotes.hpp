@@ -71,6 +71,8 @@ public:
             mActiveSet(aDataFactory->control().create()),
             mInactiveSet(aDataFactory->control().create()),
             mTrialControl(aDataFactory->control().create()),
+            mTrialGradient(aDataFactory->control().create()),
+            mComputesObjectiveGradient(false),
             mConstraintValues(aDataFactory->dual().create()),
             mDualSolver(std::make_shared<Plato::DualSolverInterface<ScalarType, OrdinalType>>(aDataFactory.operator*()))
     {
@@ -102,7 +104,20 @@ public:
         aDataMng.setActiveSet(mActiveSet.operator*());
         aDataMng.setInactiveSet(mInactiveSet.operator*());
 
-        ScalarType tObjectiveFunctionValue = aStageMng.evaluateObjective(mTrialControl.operator*());
+        // MMA always accepts the trial control; hence, if the stage manager computes the objective value and
+        // gradient in a single evaluation, the gradient needed at the next iteration is computed here
+        mComputesObjectiveGradient = aStageMng.hasFusedObjectiveAndGradient();
+        ScalarType tObjectiveFunctionValue = 0;
+        if(mComputesObjectiveGradient == true)
+        {
+            tObjectiveFunctionValue =
+                    aStageMng.evaluateObjectiveAndGradient(mTrialControl.operator*(), mTrialGradient.operator*());
+            aDataMng.setCurrentObjectiveGradient(mTrialGradient.operator*());
+        }
+        else
+        {
+            tObjectiveFunctionValue = aStageMng.evaluateObjective(mTrialControl.operator*());
+        }
         aDataMng.setCurrentObjectiveFunctionValue(tObjectiveFunctionValue);
         aStageMng.evaluateConstraints(mTrialControl.operator*(), mConstraintValues.operator*());
         aDataMng.setCurrentConstraintValues(mConstraintValues.operator*());
@@ -113,12 +128,23 @@ public:
     {
         mDualSolver->initializeAuxiliaryVariables(aDataMng);
     }
+    void restoreAuxiliaryVariables(Plato::ConservativeConvexSeparableAppxDataMng<ScalarType, OrdinalType> & aDataMng)
+    {
+        mDualSolver->initializeAuxiliaryVariables(aDataMng);
+        mDualSolver->setInitialGuess(aDataMng.getDual());
+    }
+    bool computesObjectiveGradient() const
+    {
+        return (mComputesObjectiveGradient);
+    }
 
 private:
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mTrialDual;
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mActiveSet;
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mInactiveSet;
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mTrialControl;
+    std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mTrialGradient;
+    bool mComputesObjectiveGradient;
     std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mConstraintValues;
 
     std::shared_ptr<Plato::DualProblemSolver<ScalarType, OrdinalType>> mDualSolver;
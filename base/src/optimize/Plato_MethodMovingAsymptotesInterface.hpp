@@ -284,6 +284,7 @@ private:
         Plato::ConservativeConvexSeparableAppxAlgorithm<ScalarType, OrdinalType> tAlgorithm(tStageMng, aDataMng, tSubProblem);
         this->setParameters(tAlgorithm);
         tAlgorithm.enableDiagnostics();
+        Plato::setCheckpointAndRestart(mInterface, mInputData, mComm, tAlgorithm);
         tAlgorithm.solve();
     }
 
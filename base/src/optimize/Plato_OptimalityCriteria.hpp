@@ -51,6 +51,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <functional>
 
 #include "Plato_Vector.hpp"
 #include "Plato_HostBounds.hpp"
@@ -81,9 +82,12 @@ public:
                        const std::shared_ptr<Plato::OptimalityCriteriaSubProblem<ScalarType, OrdinalType>> & aSubProblem) :
             mPrintDiagnostics(false),
             mOutputStream(),
+            mIsRestart(false),
             mMaxNumIterations(50),
             mNumIterationsDone(0),
             mProblemUpdateFrequency(0), // zero for no update
+            mCheckpointFrequency(0),
+            mCheckpointFunction(),
             mFeasibilityTolerance(1e-5),
             mControlStagnationTolerance(1e-2),
             mObjectiveGradientTolerance(1e-8),
@@ -226,6 +230,38 @@ public:
         return (*mDataMng);
     }
 
+    /******************************************************************************//**
+     * @brief Call a function every aFrequency iterations, e.g. to write a checkpoint
+     * @param [in] aFrequency number of iterations between calls; zero disables the calls
+     * @param [in] aFunction function called after the iteration is done
+    **********************************************************************************/
+    void setCheckpointFunction(const OrdinalType & aFrequency, const std::function<void()> & aFunction)
+    {
+        mCheckpointFrequency = aFrequency;
+        mCheckpointFunction = aFunction;
+    }
+
+    /******************************************************************************//**
+     * @brief Write this rank's part of the algorithm state to a checkpoint
+     * @param [in,out] aWriter checkpoint writer
+    **********************************************************************************/
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+    {
+        mDataMng->writeCheckpoint(aWriter);
+        aWriter.write("oc/num_iterations", static_cast<double>(mNumIterationsDone));
+    }
+
+    /******************************************************************************//**
+     * @brief Restore the algorithm state; solve() then continues from the checkpointed iteration
+     * @param [in] aReader checkpoint reader
+    **********************************************************************************/
+    void readCheckpoint(const Plato::CheckpointReader & aReader)
+    {
+        mDataMng->readCheckpoint(aReader);
+        mNumIterationsDone = aReader.read("oc/num_iterations");
+        mIsRestart = true;
+    }
+
     /******************************************************************************//**
      * @brief Solve optimization problem using Optimality criteria algorithm
     **********************************************************************************/
@@ -234,7 +270,12 @@ public:
         this->openOutputFile();
         this->checkInitialGuess();
 
-        mNumIterationsDone = 0;
+        // a restart continues the iteration count; the first update re-evaluates the
+        // criteria at the restored control
+        if(mIsRestart == false)
+        {
+            mNumIterationsDone = 0;
+        }
         while(1)
         {
             mStageMng->update(*mDataMng);
@@ -255,10 +296,23 @@ public:
             mNumIterationsDone++;
 
             this->conditionallyUpdateProblem();
+            this->conditionallyWriteCheckpoint();
         }
     }
 
 private:
+    /******************************************************************************//**
+     * @brief Call the checkpoint function if this iteration is a multiple of the checkpoint frequency.
+     **********************************************************************************/
+    void conditionallyWriteCheckpoint()
+    {
+        const bool tHaveCheckpointFrequency = mCheckpointFrequency > static_cast<OrdinalType>(0);
+        if(tHaveCheckpointFrequency && (mNumIterationsDone % mCheckpointFrequency) == static_cast<OrdinalType>(0))
+        {
+            mCheckpointFunction();
+        }
+    }
+
     /******************************************************************************//**
      * @brief Invoke update problem stage if needed.
      **********************************************************************************/
@@ -306,8 +360,16 @@ private:
                 const OrdinalType tNumConstraints = mDataMng->getNumConstraints();
                 mOutputData.mConstraints.clear();
                 mOutputData.mConstraints.resize(tNumConstraints);
-                mOutputStream.open("plato_optimality_criteria_diagnostics.txt");
-                Plato::print_oc_diagnostics_header(mOutputData, mOutputStream, mPrintDiagnostics);
+                if(mIsRestart == true)
+                {
+                    // a restarted run continues the diagnostics of the run it restarts
+                    mOutputStream.open("plato_optimality_criteria_diagnostics.txt", std::ios::app);
+                }
+                else
+                {
+                    mOutputStream.open("plato_optimality_criteria_diagnostics.txt");
+                    Plato::print_oc_diagnostics_header(mOutputData, mOutputStream, mPrintDiagnostics);
+                }
             }
         }
     }
@@ -512,9 +574,12 @@ private:
     bool mPrintDiagnostics;
     std::ofstream mOutputStream;
 
+    bool mIsRestart;
     OrdinalType mMaxNumIterations;
     OrdinalType mNumIterationsDone;
     OrdinalType mProblemUpdateFrequency;
+    OrdinalType mCheckpointFrequency;
+    std::function<void()> mCheckpointFunction;
 
     ScalarType mFeasibilityTolerance;
     ScalarType mControlStagnationTolerance;
@@ -58,6 +58,7 @@
 #include "Plato_MultiVector.hpp"
 #include "Plato_DataFactory.hpp"
 #include "Plato_ReductionOperations.hpp"
+#include "Plato_CheckpointUtilities.hpp"
 
 namespace Plato
 {
@@ -629,6 +630,30 @@ public:
         }
     }
 
+    //! Writes this rank's part of the iterate and multipliers to a checkpoint
+    void writeCheckpoint(Plato::CheckpointWriter & aWriter) const
+    {
+        Plato::write_checkpoint("oc/current_dual", *mCurrentDual, aWriter);
+        Plato::write_checkpoint("oc/current_control", *mCurrentControl, aWriter);
+        Plato::write_checkpoint("oc/previous_control", *mPreviousControl, aWriter);
+        Plato::write_checkpoint("oc/previous_constraint_values", *mPreviousConstraintValues, aWriter);
+        aWriter.write("oc/num_objective_evaluations", static_cast<double>(mNumObjFuncEval));
+        aWriter.write("oc/num_objective_gradient_evaluations", static_cast<double>(mNumObjGradEval));
+        aWriter.write("oc/previous_objective_value", static_cast<double>(mPreviousObjectiveValue));
+    }
+    //! Restores data written by writeCheckpoint
+    void readCheckpoint(const Plato::CheckpointReader & aReader)
+    {
+        Plato::read_checkpoint("oc/current_dual", aReader, *mCurrentDual);
+        Plato::read_checkpoint("oc/current_control", aReader, *mCurrentControl);
+        Plato::read_checkpoint("oc/previous_control", aReader, *mPreviousControl);
+        Plato::read_checkpoint("oc/previous_constraint_values", aReader, *mPreviousConstraintValues);
+        mNumObjFuncEval = aReader.read("oc/num_objective_evaluations");
+        mNumObjGradEval = aReader.read("oc/num_objective_gradient_evaluations");
+        mPreviousObjectiveValue = aReader.read("oc/previous_objective_value");
+        mInitialGuessSet = true;
+    }
+
 private:
     void initialize(const std::shared_ptr<Plato::DataFactory<ScalarType, OrdinalType>> & aFactory)
     {
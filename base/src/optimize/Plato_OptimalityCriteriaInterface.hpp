@@ -267,6 +267,7 @@ private:
         Plato::OptimalityCriteria<ScalarType, OrdinalType> tAlgorithm(aDataMng, tStageMng, tSubProblem);
         this->setParameters(tAlgorithm);
         tAlgorithm.enableDiagnostics();
+        Plato::setCheckpointAndRestart(mInterface, mInputData, mComm, tAlgorithm);
         tAlgorithm.solve();
     }
 
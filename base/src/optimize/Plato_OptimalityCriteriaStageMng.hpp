@@ -128,10 +128,24 @@ public:
     //! Directive to update optimization specific data once the trial control is accepted.
     void update(Plato::OptimalityCriteriaDataMng<ScalarType, OrdinalType> & aDataMng)
     {
-        // Evaluate objective function
+        // Evaluate objective function; its gradient is computed in the same evaluation if the objective supports it
         assert(mObjective.get() != nullptr);
         const Plato::MultiVector<ScalarType, OrdinalType> & tControl = aDataMng.getCurrentControl();
-        ScalarType tObjectiveValue = mObjective->value(tControl);
+        const bool tFusedObjectiveAndGradient = mObjective->hasFusedValueAndGradient();
+        ScalarType tObjectiveValue = 0;
+        if(tFusedObjectiveAndGradient == true)
+        {
+            Plato::fill(static_cast<ScalarType>(0), mWorkMyGradient.operator*());
+            tObjectiveValue = mObjective->valueAndGradient(tControl, mWorkMyGradient.operator*());
+            mNumObjGradEval++;
+
+            aDataMng.setObjectiveGradient(mWorkMyGradient.operator*());
+            aDataMng.setNumObjectiveGradientEvaluations(mNumObjGradEval);
+        }
+        else
+        {
+            tObjectiveValue = mObjective->value(tControl);
+        }
         mNumObjFuncEval++;
 
         aDataMng.setCurrentObjectiveValue(tObjectiveValue);
@@ -150,12 +164,15 @@ public:
         this->cacheData();
 
         // Compute objective gradient
-        Plato::fill(static_cast<ScalarType>(0), mWorkMyGradient.operator*());
-        mObjective->gradient(tControl, mWorkMyGradient.operator*());
-        mNumObjGradEval++;
+        if(tFusedObjectiveAndGradient == false)
+        {
+            Plato::fill(static_cast<ScalarType>(0), mWorkMyGradient.operator*());
+            mObjective->gradient(tControl, mWorkMyGradient.operator*());
+            mNumObjGradEval++;
 
-        aDataMng.setObjectiveGradient(mWorkMyGradient.operator*());
-        aDataMng.setNumObjectiveGradientEvaluations(mNumObjGradEval);
+            aDataMng.setObjectiveGradient(mWorkMyGradient.operator*());
+            aDataMng.setNumObjectiveGradientEvaluations(mNumObjGradEval);
+        }
 
         // Compute constraint gradients
         for(OrdinalType tConstraintIndex = 0; tConstraintIndex < tNumConstraints; tConstraintIndex++)
@@ -49,6 +49,7 @@
 #ifndef PLATO_OPTIMIZERUTILITIES_HPP_
 #define PLATO_OPTIMIZERUTILITIES_HPP_
 
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <memory>
@@ -57,6 +58,7 @@
 
 #include "Plato_Parser.hpp"
 #include "Plato_Interface.hpp"
+#include "Plato_Checkpoint.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 
 namespace Plato
@@ -243,6 +245,77 @@ inline void getInitialGuessInputData(const std::string & aControlName,
     }
 }
 
+/********************************************************************************/
+inline std::string getOptimizerCheckpointFileName(Plato::Interface* aInterface, int aSlot, const MPI_Comm & aComm)
+/********************************************************************************/
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(aComm, &tMyRank);
+    return Plato::checkpoint_file_name(aInterface->getCheckpointFileName() + "_optimizer", aSlot, tMyRank);
+}
+
+/********************************************************************************/
+template<typename AlgorithmType>
+inline void setCheckpointAndRestart(Plato::Interface* aInterface,
+                                    const Plato::OptimizerEngineStageData & aInputData,
+                                    const MPI_Comm & aComm,
+                                    AlgorithmType & aAlgorithm)
+/********************************************************************************/
+{
+    // the optimizer checkpoint carries the tag of the shared data checkpoint written with it and
+    // goes to the same slot. On restart the interface picks the newest slot whose tags match on
+    // every rank and restores the optimizer from it inside its collective error check
+    if(aInputData.getRestartFromCheckpoint())
+    {
+        std::vector<std::shared_ptr<Plato::CheckpointReader>> tReaders(Plato::cNumCheckpointSlots);
+        std::vector<int> tTags(Plato::cNumCheckpointSlots, -1);
+        for(int tSlot = 0; tSlot < Plato::cNumCheckpointSlots; tSlot++)
+        {
+            try
+            {
+                tReaders[tSlot] = std::make_shared<Plato::CheckpointReader>(Plato::getOptimizerCheckpointFileName(aInterface, tSlot, aComm));
+                tTags[tSlot] = tReaders[tSlot]->read("checkpoint/tag");
+            }
+            catch(...)
+            {
+                tReaders[tSlot].reset();
+                tTags[tSlot] = -1;
+            }
+        }
+        aInterface->readCheckpoint(tTags, [&tReaders, &aAlgorithm](int aSlot)
+        {
+            aAlgorithm.readCheckpoint(*tReaders[aSlot]);
+        });
+    }
+
+    const size_t tCheckpointFrequency = aInputData.getCheckpointFrequency();
+    if(tCheckpointFrequency > static_cast<size_t>(0))
+    {
+        aAlgorithm.setCheckpointFunction(tCheckpointFrequency, [aInterface, aComm, &aAlgorithm]()
+        {
+            const int tNextTag = aInterface->getCheckpointTag() + 1;
+            try
+            {
+                Plato::CheckpointWriter tWriter(Plato::getOptimizerCheckpointFileName(aInterface, Plato::checkpoint_slot(tNextTag), aComm));
+                tWriter.write("checkpoint/tag", static_cast<double>(tNextTag));
+                aAlgorithm.writeCheckpoint(tWriter);
+                tWriter.close();
+                if(tNextTag == 1)
+                {
+                    // the other slot can only hold a checkpoint of an earlier run
+                    const int tOtherSlot = Plato::checkpoint_slot(tNextTag + 1);
+                    std::remove(Plato::getOptimizerCheckpointFileName(aInterface, tOtherSlot, aComm).c_str());
+                }
+            }
+            catch(...)
+            {
+                aInterface->Catch();
+            }
+            aInterface->writeCheckpoint();
+        });
+    }
+}
+
 } //namespace Plato
 
 #endif /* PLATO_OPTIMIZERUTILITIES_HPP_ */
@@ -236,6 +236,36 @@ public:
         mNumObjGradEval++;
     }
 
+    /******************************************************************************//**
+     * @brief Evaluate objective function and compute its gradient at the same control
+     * @param [in] aControl current controls (i.e. optimization variables)
+     * @param [in,out] aOutput gradient
+     * @return objective function value
+    **********************************************************************************/
+    ScalarType evaluateObjectiveAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                            Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        assert(mObjective.get() != nullptr);
+        assert(mObjectiveGradient.get() != nullptr);
+
+        Plato::fill(static_cast<ScalarType>(0), aOutput);
+        ScalarType tObjectiveFunctionValue = mObjectiveGradient->computeWithValue(*mObjective, aControl, aOutput);
+        mNumObjFunEval++;
+        mNumObjGradEval++;
+
+        return (tObjectiveFunctionValue);
+    }
+
+    /******************************************************************************//**
+     * @brief Indicates if the objective value and gradient are computed in a single evaluation
+    **********************************************************************************/
+    bool hasFusedObjectiveAndGradient() const
+    {
+        assert(mObjective.get() != nullptr);
+        assert(mObjectiveGradient.get() != nullptr);
+        return (mObjectiveGradient->hasFusedValueAndGradient(*mObjective));
+    }
+
     /******************************************************************************//**
      * @brief Evaluate each constraint defined for the optimization problem
      * @param [in] aControl current controls (i.e. optimization variables)
@@ -217,6 +217,44 @@ public:
         }
         mNumObjGradEval++;
     }
+    /*! Evaluate objective function F(\mathbf{z})=\sum_{i=1}^{n}f_i(\mathbf{z}) and its reduced gradient at the
+     *  same control. Each objective is asked for its value and gradient in a single evaluation. */
+    ScalarType evaluateObjectiveAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                            Plato::MultiVector<ScalarType, OrdinalType> & aOutput,
+                                            ScalarType aTolerance = std::numeric_limits<ScalarType>::max())
+    {
+        assert(mObjectives.get() != nullptr);
+        assert(mObjectivesGradient.get() != nullptr);
+
+        ScalarType tOutput = 0;
+        Plato::fill(static_cast<ScalarType>(0), aOutput);
+        const OrdinalType tNumObjectives = mObjectives->size();
+        for(OrdinalType tIndex = 0; tIndex < tNumObjectives; tIndex++)
+        {
+            Plato::fill(static_cast<ScalarType>(0), *mWorkVec);
+            ScalarType tMyValue =
+                    (*mObjectivesGradient)[tIndex].computeWithValue((*mObjectives)[tIndex], aControl, *mWorkVec);
+            ScalarType tMyWeight = mObjectives->weight(tIndex);
+            tOutput += tMyWeight * tMyValue;
+            Plato::update(tMyWeight, *mWorkVec, static_cast<ScalarType>(1), aOutput);
+        }
+        mNumObjFuncEval++;
+        mNumObjGradEval++;
+        return (tOutput);
+    }
+    //! True if every objective computes its value and gradient in a single evaluation
+    bool hasFusedObjectiveAndGradient() const
+    {
+        const OrdinalType tNumObjectives = mObjectives->size();
+        for(OrdinalType tIndex = 0; tIndex < tNumObjectives; tIndex++)
+        {
+            if((*mObjectivesGradient)[tIndex].hasFusedValueAndGradient((*mObjectives)[tIndex]) == false)
+            {
+                return (false);
+            }
+        }
+        return (true);
+    }
     /*! Compute the application of a vector to the reduced Hessian. The reduced Hessian is defined as
      *  \nabla_{\mathbf{z}}^{2}{F}=\sum_{i=1}^{n}\nabla_{\mathbf{z}}^{2}f_i(\mathbf{z})\ \forall\ i=1,
      *  \dots,n, where i\in\mathcal{N} and $n$ denotes the number of objective functions. */
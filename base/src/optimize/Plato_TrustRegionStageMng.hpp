@@ -87,6 +87,21 @@ public:
                                           ScalarType aTolerance = std::numeric_limits<ScalarType>::max()) = 0;
     virtual void computeGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                                  Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
+    //! Evaluate objective and compute its gradient at the same control; derived classes override this
+    //! method when both quantities can be computed in a single evaluation.
+    virtual ScalarType evaluateObjectiveAndGradient(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                                    Plato::MultiVector<ScalarType, OrdinalType> & aOutput,
+                                                    ScalarType aTolerance = std::numeric_limits<ScalarType>::max())
+    {
+        const ScalarType tValue = this->evaluateObjective(aControl, aTolerance);
+        this->computeGradient(aControl, aOutput);
+        return (tValue);
+    }
+    //! Indicates if evaluateObjectiveAndGradient computes both quantities in a single evaluation
+    virtual bool hasFusedObjectiveAndGradient() const
+    {
+        return (false);
+    }
     virtual void applyVectorToHessian(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
                                       const Plato::MultiVector<ScalarType, OrdinalType> & aVector,
                                       Plato::MultiVector<ScalarType, OrdinalType> & aOutput) = 0;
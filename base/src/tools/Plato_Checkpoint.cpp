@@ -0,0 +1,282 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Checkpoint.cpp
+ *
+ */
+
+#include "Plato_Checkpoint.hpp"
+#include "Plato_Exceptions.hpp"
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+
+namespace Plato
+{
+
+namespace
+{
+
+const char cMagic[8] = {'P', 'L', 'A', 'T', 'O', 'C', 'K', 'P'};
+const uint32_t cVersion = 1;
+
+}
+
+/******************************************************************************/
+std::string checkpoint_file_name(const std::string & aBaseName, int aRank)
+/******************************************************************************/
+{
+    std::stringstream tName;
+    tName << aBaseName << "." << aRank << ".bin";
+    return tName.str();
+}
+
+/******************************************************************************/
+int checkpoint_slot(int aTag)
+/******************************************************************************/
+{
+    return aTag % cNumCheckpointSlots;
+}
+
+/******************************************************************************/
+std::string checkpoint_file_name(const std::string & aBaseName, int aSlot, int aRank)
+/******************************************************************************/
+{
+    std::stringstream tName;
+    tName << aBaseName << "_" << aSlot;
+    return Plato::checkpoint_file_name(tName.str(), aRank);
+}
+
+/******************************************************************************/
+CheckpointWriter::CheckpointWriter(const std::string & aFileName) :
+        mFileName(aFileName),
+        mTempFileName(aFileName + ".tmp"),
+        mOutput(mTempFileName, std::ios::binary | std::ios::trunc)
+/******************************************************************************/
+{
+    if(!mOutput)
+    {
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: CheckpointWriter: Could not open '" << mTempFileName << "' for writing.\n\n";
+        throw Plato::ParsingException(tMsg.str());
+    }
+    mOutput.write(cMagic, sizeof(cMagic));
+    mOutput.write(reinterpret_cast<const char*>(&cVersion), sizeof(cVersion));
+}
+
+/******************************************************************************/
+CheckpointWriter::~CheckpointWriter()
+/******************************************************************************/
+{
+    // an unclosed checkpoint is incomplete; keep the previous one
+    if(mOutput.is_open())
+    {
+        mOutput.close();
+        std::remove(mTempFileName.c_str());
+    }
+}
+
+/******************************************************************************/
+void CheckpointWriter::write(const std::string & aName, const double* aData, size_t aLength)
+/******************************************************************************/
+{
+    const uint32_t tNameLength = aName.size();
+    const uint64_t tLength = aLength;
+    mOutput.write(reinterpret_cast<const char*>(&tNameLength), sizeof(tNameLength));
+    mOutput.write(aName.data(), tNameLength);
+    mOutput.write(reinterpret_cast<const char*>(&tLength), sizeof(tLength));
+    if(aLength > 0u)
+    {
+        mOutput.write(reinterpret_cast<const char*>(aData), aLength * sizeof(double));
+    }
+}
+
+/******************************************************************************/
+void CheckpointWriter::write(const std::string & aName, const std::vector<double> & aData)
+/******************************************************************************/
+{
+    this->write(aName, aData.data(), aData.size());
+}
+
+/******************************************************************************/
+void CheckpointWriter::write(const std::string & aName, double aValue)
+/******************************************************************************/
+{
+    this->write(aName, &aValue, 1u);
+}
+
+/******************************************************************************/
+void CheckpointWriter::close()
+/******************************************************************************/
+{
+    mOutput.close();
+    if(mOutput.fail() || std::rename(mTempFileName.c_str(), mFileName.c_str()) != 0)
+    {
+        std::remove(mTempFileName.c_str());
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: CheckpointWriter: Failed to write '" << mFileName << "'.\n\n";
+        throw Plato::ParsingException(tMsg.str());
+    }
+}
+
+/******************************************************************************/
+CheckpointReader::CheckpointReader(const std::string & aFileName) :
+        mFileName(aFileName),
+        mRecords()
+/******************************************************************************/
+{
+    std::ifstream tInput(aFileName, std::ios::binary | std::ios::ate);
+    const std::streamoff tFileSize = tInput ? static_cast<std::streamoff>(tInput.tellg()) : 0;
+    tInput.seekg(0);
+    char tMagic[sizeof(cMagic)] = {0};
+    uint32_t tVersion = 0;
+    tInput.read(tMagic, sizeof(tMagic));
+    tInput.read(reinterpret_cast<char*>(&tVersion), sizeof(tVersion));
+    if(!tInput || std::memcmp(tMagic, cMagic, sizeof(cMagic)) != 0 || tVersion != cVersion)
+    {
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: CheckpointReader: '" << aFileName << "' is missing or is not a Plato checkpoint file.\n\n";
+        throw Plato::ParsingException(tMsg.str());
+    }
+
+    // lengths are checked against the bytes left before allocating, so a corrupt length
+    // is reported as a truncated file rather than a huge allocation
+    uint32_t tNameLength = 0;
+    while(tInput.read(reinterpret_cast<char*>(&tNameLength), sizeof(tNameLength)))
+    {
+        uint64_t tLength = 0;
+        std::string tName;
+        if(tNameLength <= static_cast<uint64_t>(tFileSize - tInput.tellg()))
+        {
+            tName.resize(tNameLength);
+            tInput.read(&tName[0], tNameLength);
+            tInput.read(reinterpret_cast<char*>(&tLength), sizeof(tLength));
+        }
+        else
+        {
+            tInput.setstate(std::ios::failbit);
+        }
+        if(!tInput || tLength > static_cast<uint64_t>(tFileSize - tInput.tellg()) / sizeof(double))
+        {
+            std::stringstream tMsg;
+            tMsg << "\n\n ********** PLATO ERROR: CheckpointReader: '" << aFileName << "' is truncated.\n\n";
+            throw Plato::ParsingException(tMsg.str());
+        }
+        std::vector<double> & tData = mRecords[tName];
+        tData.resize(tLength);
+        if(tLength > 0u)
+        {
+            tInput.read(reinterpret_cast<char*>(tData.data()), tLength * sizeof(double));
+        }
+        if(!tInput)
+        {
+            std::stringstream tMsg;
+            tMsg << "\n\n ********** PLATO ERROR: CheckpointReader: '" << aFileName << "' is truncated.\n\n";
+            throw Plato::ParsingException(tMsg.str());
+        }
+    }
+}
+
+/******************************************************************************/
+bool CheckpointReader::has(const std::string & aName) const
+/******************************************************************************/
+{
+    return mRecords.find(aName) != mRecords.end();
+}
+
+/******************************************************************************/
+size_t CheckpointReader::size(const std::string & aName) const
+/******************************************************************************/
+{
+    return this->find(aName).size();
+}
+
+/******************************************************************************/
+void CheckpointReader::read(const std::string & aName, double* aData, size_t aLength) const
+/******************************************************************************/
+{
+    const std::vector<double> & tData = this->find(aName);
+    if(tData.size() != aLength)
+    {
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: CheckpointReader: Record '" << aName << "' in '" << mFileName
+             << "' has " << tData.size() << " entries, expected " << aLength << ".\n\n";
+        throw Plato::ParsingException(tMsg.str());
+    }
+    std::copy(tData.begin(), tData.end(), aData);
+}
+
+/******************************************************************************/
+void CheckpointReader::read(const std::string & aName, std::vector<double> & aData) const
+/******************************************************************************/
+{
+    aData = this->find(aName);
+}
+
+/******************************************************************************/
+double CheckpointReader::read(const std::string & aName) const
+/******************************************************************************/
+{
+    double tValue = 0.0;
+    this->read(aName, &tValue, 1u);
+    return tValue;
+}
+
+/******************************************************************************/
+const std::vector<double> & CheckpointReader::find(const std::string & aName) const
+/******************************************************************************/
+{
+    auto tIterator = mRecords.find(aName);
+    if(tIterator == mRecords.end())
+    {
+        std::stringstream tMsg;
+        tMsg << "\n\n ********** PLATO ERROR: CheckpointReader: Record '" << aName << "' not found in '" << mFileName << "'.\n\n";
+        throw Plato::ParsingException(tMsg.str());
+    }
+    return tIterator->second;
+}
+
+}
@@ -0,0 +1,126 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Checkpoint.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+
+namespace Plato
+{
+
+//! Per-rank checkpoint file name, e.g. "plato_checkpoint.3.bin"
+std::string checkpoint_file_name(const std::string & aBaseName, int aRank);
+
+//! Tagged checkpoints alternate between two slots, so a crash while writing
+//! checkpoint N leaves checkpoint N-1 intact in the other slot
+const int cNumCheckpointSlots = 2;
+
+//! Slot that the checkpoint with tag aTag is written to
+int checkpoint_slot(int aTag);
+
+//! Per-rank file name of a checkpoint slot, e.g. "plato_checkpoint_1.3.bin"
+std::string checkpoint_file_name(const std::string & aBaseName, int aSlot, int aRank);
+
+/******************************************************************************/
+//!  Writes a binary checkpoint file of named arrays of doubles
+/*!
+ Records are written to a temporary file that replaces aFileName on close(),
+ so a failure while writing leaves the previous checkpoint intact.
+ */
+/******************************************************************************/
+class CheckpointWriter
+{
+public:
+    explicit CheckpointWriter(const std::string & aFileName);
+    ~CheckpointWriter();
+
+    void write(const std::string & aName, const double* aData, size_t aLength);
+    void write(const std::string & aName, const std::vector<double> & aData);
+    void write(const std::string & aName, double aValue);
+    void close();
+
+private:
+    std::string mFileName;
+    std::string mTempFileName;
+    std::ofstream mOutput;
+
+private:
+    CheckpointWriter(const Plato::CheckpointWriter & aRhs);
+    Plato::CheckpointWriter & operator=(const Plato::CheckpointWriter & aRhs);
+};
+
+/******************************************************************************/
+//!  Reads a checkpoint file written by CheckpointWriter
+/*!
+ The whole file is read on construction.  Missing records and length
+ mismatches throw Plato::ParsingException.
+ */
+/******************************************************************************/
+class CheckpointReader
+{
+public:
+    explicit CheckpointReader(const std::string & aFileName);
+
+    bool has(const std::string & aName) const;
+    size_t size(const std::string & aName) const;
+    void read(const std::string & aName, double* aData, size_t aLength) const;
+    void read(const std::string & aName, std::vector<double> & aData) const;
+    double read(const std::string & aName) const;
+
+private:
+    const std::vector<double> & find(const std::string & aName) const;
+
+private:
+    std::string mFileName;
+    std::map<std::string, std::vector<double>> mRecords;
+};
+
+}
@@ -42,27 +42,112 @@
 
 #include "Plato_InputData.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace Plato {
-InputData::InputData() : m_name("Input Data") { init(); }
 
-InputData::InputData(std::string name) : m_name(name) { init(); }
+namespace {
+
+// process-wide table of interned names.  Keys are never removed, so references
+// to the stored strings stay valid.  InputData built on different threads share
+// the table, so every access holds its mutex.
+struct KeyTable
+{
+  std::mutex mutex;
+  std::unordered_map<std::string, unsigned int> keys;
+  std::vector<const std::string*> names;
+};
+
+KeyTable& keyTable()
+{
+  static KeyTable tTable;
+  return tTable;
+}
+
+} // end anonymous namespace
+
+InputData::InputData() { init("Input Data"); }
+
+InputData::InputData(std::string name) { init(name); }
 
-std::string InputData::name()  const { return m_name; }
-bool        InputData::empty() const { return m_parameters->empty(); }
+std::string InputData::name()  const { return keyName(m_storage->name); }
+bool        InputData::empty() const { return m_storage->entries.empty(); }
+
+void InputData::init(const std::string& name)
+  {
+    m_storage = std::make_shared<Storage>();
+    m_storage->name = intern(name);
+  }
+
+const InputData::Entries* InputData::find(const std::string& name) const
+  {
+    unsigned int key = 0;
+    if( !lookup(name, key) ){
+      return nullptr;
+    }
+    // a node has few distinct names, so a linear search beats a map here.
+    for( const Entries& entries : m_storage->entries ){
+      if( entries.key == key ){
+        return &entries;
+      }
+    }
+    return nullptr;
+  }
+
+InputData::Entries* InputData::find(const std::string& name)
+  {
+    return const_cast<Entries*>(static_cast<const InputData*>(this)->find(name));
+  }
+
+InputData::Entries& InputData::insert(const std::string& name)
+  {
+    if( Entries* entries = find(name) ){
+      return *entries;
+    }
+    m_storage->entries.push_back(Entries{intern(name), std::vector<Slot>()});
+    return m_storage->entries.back();
+  }
+
+unsigned int InputData::intern(const std::string& name)
+  {
+    KeyTable& table = keyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.keys.find(name);
+    if( it == table.keys.end() ){
+      it = table.keys.emplace(name, static_cast<unsigned int>(table.names.size())).first;
+      table.names.push_back(&it->first);
+    }
+    return it->second;
+  }
+
+bool InputData::lookup(const std::string& name, unsigned int& key)
+  {
+    KeyTable& table = keyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.keys.find(name);
+    if( it == table.keys.end() ){
+      return false;
+    }
+    key = it->second;
+    return true;
+  }
 
-void InputData::init()
+const std::string& InputData::keyName(unsigned int key)
   {
-    m_parameters = std::make_shared<std::multimap<std::string, Plato::any>>(std::multimap<std::string, Plato::any>());
+    KeyTable& table = keyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return *table.names[key];
   }
 
 #ifndef USE_CXX_14
   bool operator==(const InputData& l, const InputData& r)
   {
-    return std::tie(l.m_name,l.m_parameters) == std::tie(r.m_name, r.m_parameters);
+    return l.m_storage == r.m_storage;
   }
   std::ostream& operator<<(std::ostream& os, const InputData& v)
   {
-    os << v.m_name;
+    os << v.name();
     return os;
   }
 #endif
@@ -45,7 +45,9 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
+#include <typeinfo>
 
 #ifdef USE_CXX_14
 #include <experimental/any>
@@ -53,6 +55,8 @@ namespace Plato {
   using any = std::experimental::any;
   template <typename T>
   T any_cast(any anyVal){return std::experimental::any_cast<T>(anyVal);}
+  template <typename T>
+  const T& any_ref(const any& anyVal){return *std::experimental::any_cast<T>(&anyVal);}
 }
 #else
 #include <Teuchos_any.hpp>
@@ -61,11 +65,23 @@ namespace Plato {
   using any = Teuchos::any;
   template <typename T>
   T any_cast(any anyVal){return Teuchos::any_cast<T>(anyVal);}
+  template <typename T>
+  const T& any_ref(const any& anyVal){return Teuchos::any_cast<T>(anyVal);}
 }
 #endif
 
 namespace Plato {
 
+/*! Hierarchical {name, value} store built by the input parsers.
+ *
+ *  Names are interned once per process, so a node holds integer keys rather than
+ *  strings.  Strings and sub-InputData, which make up nearly all parsed input, are
+ *  held in typed arrays; any other type is held in a Plato::any.  Copies of an
+ *  InputData share the same storage.
+ *
+ *  The process-wide name table is guarded by a mutex, so different InputData may be
+ *  built on different threads; a single InputData and its copies are not thread-safe.
+ */
 class InputData {
  public:
   InputData();
@@ -80,23 +96,21 @@ class InputData {
    *  If an entry by this name already exists and the typeids do not match, an exception is thrown.
    */
   template <typename T>
-  void set(std::string name, const T& value, unsigned int index = 0)
+  void set(const std::string& name, const T& value, unsigned int index = 0)
   {
-    auto num = m_parameters->count(name);
+    Entries* entries = find(name);
+    unsigned int num = entries ? entries->slots.size() : 0;
 
     if( index == num ){
-      Plato::any newEntry = Plato::any(value);
-      m_parameters->insert(std::pair<std::string, Plato::any>(name, newEntry));
+      add(name, value);
     } else 
     if( index > num ){
       // attempted to set an entry that doesn't exist
       throw 1;
     } else {
-      auto it = m_parameters->lower_bound(name);
-      it = std::next(it, index);
-      auto& anyVal = it->second;
-      if( typeid(T) == anyVal.type() ){
-        anyVal = Plato::any(value);
+      const Slot& slot = entries->slots[index];
+      if( Access<T>::matches(*m_storage, slot) ){
+        Access<T>::write(*m_storage, slot, value);
       } else {
         // entry exists, but is not of type T.
         throw 1;
@@ -110,14 +124,14 @@ class InputData {
    */ 
  
   template <typename T>
-  unsigned int size(std::string name) const
+  unsigned int size(const std::string& name) const
   {
     unsigned int numWithNameAndType = 0;
-    for( auto it  = m_parameters->lower_bound(name); 
-              it != m_parameters->upper_bound(name); ++it ){
-      auto& anyVal = it->second;
-      if( typeid(T) == anyVal.type() ){
-        numWithNameAndType++;
+    if( const Entries* entries = find(name) ){
+      for( const Slot& slot : entries->slots ){
+        if( Access<T>::matches(*m_storage, slot) ){
+          numWithNameAndType++;
+        }
       }
     }
     return numWithNameAndType;
@@ -129,24 +143,32 @@ class InputData {
    */ 
  
   template <typename T>
-  T get(std::string name, unsigned int index = 0) const
+  T get(const std::string& name, unsigned int index = 0) const
   {
-    auto num = m_parameters->count(name);
-
-    if( index >= num ){
-      // requested an entry that doesn't exist.
+    const T* value = view<T>(name, index);
+    if( value == nullptr ){
+      // requested an entry that doesn't exist or isn't of type T.
       throw 1;
-    } else {
-      auto it = m_parameters->lower_bound(name);
-      it = std::next(it, index);
-      auto& anyVal = it->second;
-      if( typeid(T) == anyVal.type() ){
-        return Plato::any_cast<T>(anyVal);
-      } else {
-        // entry exists, but is not of type T.
-        throw 1;
-      }
     }
+    return *value;
+  }
+
+  /*! View the value that maps to the given name without copying it.
+   *  Returns nullptr if the entry doesn't exist or isn't of type T.  The pointer is valid
+   *  until the next entry is added to this InputData.
+   */
+  template <typename T>
+  const T* view(const std::string& name, unsigned int index = 0) const
+  {
+    const Entries* entries = find(name);
+    if( entries == nullptr || index >= entries->slots.size() ){
+      return nullptr;
+    }
+    const Slot& slot = entries->slots[index];
+    if( Access<T>::matches(*m_storage, slot) == false ){
+      return nullptr;
+    }
+    return &Access<T>::read(*m_storage, slot);
   }
 
   /*! Get or create and get the unique value that maps to the given name.
@@ -155,9 +177,10 @@ class InputData {
    */ 
  
   template <typename T>
-  T get_add(std::string name, unsigned int index = 0) 
+  T get_add(const std::string& name, unsigned int index = 0) 
   {
-    auto num = m_parameters->count(name);
+    const Entries* entries = find(name);
+    unsigned int num = entries ? entries->slots.size() : 0;
     if( index == num ){
       add(name, T());
     } else 
@@ -172,17 +195,14 @@ class InputData {
    *   
    */
   template <typename T>
-  void add(std::string name, const T& value)
+  void add(const std::string& name, const T& value)
   {
-    auto range = m_parameters->equal_range(name);
-    for(auto it=range.first; it!=range.second; ++it){
-      auto& anyVal = it->second;
-      if( typeid(T) != anyVal.type() ){
-        // non-unique entries are required to be of the same type.
-        throw 1;
-      }
+    Entries& entries = insert(name);
+    if( !entries.slots.empty() && !Access<T>::matches(*m_storage, entries.slots.front()) ){
+      // non-unique entries are required to be of the same type.
+      throw 1;
     }
-    m_parameters->insert(std::pair<std::string, Plato::any>(name, Plato::any(value)));
+    entries.slots.push_back(Access<T>::append(*m_storage, value));
   }
 
 
@@ -190,18 +210,33 @@ class InputData {
    *
    */
   template <typename T>
-  std::vector<T> getByName(std::string name) const
+  std::vector<T> getByName(const std::string& name) const
   {
     std::vector<T> retVector;
-    auto range = m_parameters->equal_range(name);
-    for( auto it = range.first; it != range.second; ++it){
-      auto& anyVal = it->second;
-      if( typeid(T) == anyVal.type() ){
-        retVector.push_back(Plato::any_cast<T>(anyVal));
+    if( const Entries* entries = find(name) ){
+      retVector.reserve(entries->slots.size());
+      for( const Slot& slot : entries->slots ){
+        if( Access<T>::matches(*m_storage, slot) ){
+          retVector.push_back(Access<T>::read(*m_storage, slot));
+        }
       }
     }
     return retVector;
   }
+
+  /*! Call aFunction(const T&) on each entry with this name and type, without copying the values.
+   */
+  template <typename T, typename Function>
+  void forEach(const std::string& name, Function aFunction) const
+  {
+    if( const Entries* entries = find(name) ){
+      for( const Slot& slot : entries->slots ){
+        if( Access<T>::matches(*m_storage, slot) ){
+          aFunction(Access<T>::read(*m_storage, slot));
+        }
+      }
+    }
+  }
   
 #ifndef USE_CXX_14
   friend bool operator==(const InputData& l, const InputData& r);
@@ -210,12 +245,70 @@ class InputData {
 
 
  private:
-  std::string m_name;
-  std::shared_ptr<std::multimap<std::string, Plato::any>> m_parameters;
+  enum slot_t : unsigned char { STRING_SLOT, NODE_SLOT, ANY_SLOT };
+
+  struct Slot {
+    slot_t type;
+    unsigned int index;
+  };
+
+  //! all entries with one (interned) name, in insertion order
+  struct Entries {
+    unsigned int key;
+    std::vector<Slot> slots;
+  };
+
+  struct Storage {
+    unsigned int name;
+    std::vector<Entries> entries;
+    std::vector<std::string> strings;
+    std::vector<InputData> nodes;
+    std::vector<Plato::any> values;
+  };
+
+  //! typed access to a Storage; specialized for the types that get their own arrays
+  template <typename T>
+  struct Access {
+    static bool matches(const Storage& s, const Slot& slot)
+      { return slot.type == ANY_SLOT && typeid(T) == s.values[slot.index].type(); }
+    static const T& read(const Storage& s, const Slot& slot)
+      { return Plato::any_ref<T>(s.values[slot.index]); }
+    static void write(Storage& s, const Slot& slot, const T& value)
+      { s.values[slot.index] = Plato::any(value); }
+    static Slot append(Storage& s, const T& value)
+      { s.values.push_back(Plato::any(value)); return Slot{ANY_SLOT, static_cast<unsigned int>(s.values.size()-1)}; }
+  };
+
+  std::shared_ptr<Storage> m_storage;
+
+  void init(const std::string& name);
 
-  void init();
+  const Entries* find(const std::string& name) const;
+  Entries* find(const std::string& name);
+  Entries& insert(const std::string& name);
+
+  static unsigned int intern(const std::string& name);
+  static bool lookup(const std::string& name, unsigned int& key);
+  static const std::string& keyName(unsigned int key);
+};
+
+template <>
+struct InputData::Access<std::string> {
+  static bool matches(const Storage&, const Slot& slot) { return slot.type == STRING_SLOT; }
+  static const std::string& read(const Storage& s, const Slot& slot) { return s.strings[slot.index]; }
+  static void write(Storage& s, const Slot& slot, const std::string& value) { s.strings[slot.index] = value; }
+  static Slot append(Storage& s, const std::string& value)
+    { s.strings.push_back(value); return Slot{STRING_SLOT, static_cast<unsigned int>(s.strings.size()-1)}; }
+};
+
+template <>
+struct InputData::Access<InputData> {
+  static bool matches(const Storage&, const Slot& slot) { return slot.type == NODE_SLOT; }
+  static const InputData& read(const Storage& s, const Slot& slot) { return s.nodes[slot.index]; }
+  static void write(Storage& s, const Slot& slot, const InputData& value) { s.nodes[slot.index] = value; }
+  static Slot append(Storage& s, const InputData& value)
+    { s.nodes.push_back(value); return Slot{NODE_SLOT, static_cast<unsigned int>(s.nodes.size()-1)}; }
 };
 
 } // end namespace Plato
 #endif
-
@@ -63,6 +63,7 @@ OptimizerEngineStageData::OptimizerEngineStageData() :
         mOutputDiagnosticsToFile(false),
         mHaveHessian(true),
         mDisablePostSmoothing(false),
+        mRestartFromCheckpoint(false),
         mGCMMAMaxInnerIterations(5),
         mInitialMovingAsymptoteScaleFactor(0.5),
         mGCMMAInnerKKTTolerance(5e-4),
@@ -89,6 +90,9 @@ OptimizerEngineStageData::OptimizerEngineStageData() :
         mAugLagPenaltyScaleParameter(1.2),
         mMaxNumIterations(500),
         mProblemUpdateFrequency(0),
+        mEvaluationCacheSize(0),
+        mCheckpointFrequency(0),
+        mObjectiveBatchSize(1),
         mDerivativeCheckerFinalSuperscript(8),
         mDerivativeCheckerInitialSuperscript(1),
         mAlgebra(),
@@ -110,6 +114,9 @@ OptimizerEngineStageData::OptimizerEngineStageData() :
         mObjectiveValueStageName(),
         mObjectiveHessianStageName(),
         mObjectiveGradientStageName(),
+        mObjectiveValueAndGradientStageName(),
+        mObjectiveBatchValueStageName(),
+        mObjectiveBatchGradientStageName(),
         mInitialGuess(std::vector<double>(1, 0.5)),
         mLowerBoundValues(std::vector<double>(1, 0.)),
         mUpperBoundValues(std::vector<double>(1, 1.)),
@@ -937,6 +944,65 @@ void OptimizerEngineStageData::setObjectiveGradientStageName(const std::string &
     mObjectiveGradientStageName.assign(aInput.begin(), aInput.end());
 }
 
+/******************************************************************************/
+std::string OptimizerEngineStageData::getObjectiveValueAndGradientStageName() const
+/******************************************************************************/
+{
+    return (mObjectiveValueAndGradientStageName);
+}
+
+/******************************************************************************/
+void OptimizerEngineStageData::setObjectiveValueAndGradientStageName(const std::string & aInput)
+/******************************************************************************/
+{
+    mObjectiveValueAndGradientStageName.clear();
+    mObjectiveValueAndGradientStageName.assign(aInput.begin(), aInput.end());
+}
+
+/******************************************************************************/
+std::string OptimizerEngineStageData::getObjectiveBatchValueStageName() const
+/******************************************************************************/
+{
+    return (mObjectiveBatchValueStageName);
+}
+
+/******************************************************************************/
+void OptimizerEngineStageData::setObjectiveBatchValueStageName(const std::string & aInput)
+/******************************************************************************/
+{
+    mObjectiveBatchValueStageName.clear();
+    mObjectiveBatchValueStageName.assign(aInput.begin(), aInput.end());
+}
+
+/******************************************************************************/
+std::string OptimizerEngineStageData::getObjectiveBatchGradientStageName() const
+/******************************************************************************/
+{
+    return (mObjectiveBatchGradientStageName);
+}
+
+/******************************************************************************/
+void OptimizerEngineStageData::setObjectiveBatchGradientStageName(const std::string & aInput)
+/******************************************************************************/
+{
+    mObjectiveBatchGradientStageName.clear();
+    mObjectiveBatchGradientStageName.assign(aInput.begin(), aInput.end());
+}
+
+/******************************************************************************/
+size_t OptimizerEngineStageData::getObjectiveBatchSize() const
+/******************************************************************************/
+{
+    return (mObjectiveBatchSize);
+}
+
+/******************************************************************************/
+void OptimizerEngineStageData::setObjectiveBatchSize(const size_t & aInput)
+/******************************************************************************/
+{
+    mObjectiveBatchSize = aInput;
+}
+
 /******************************************************************************/
 std::string OptimizerEngineStageData::getInitializationStageName() const
 /******************************************************************************/
@@ -1400,4 +1466,38 @@ void OptimizerEngineStageData::setProblemUpdateFrequency(const size_t& aInput)
     mProblemUpdateFrequency = aInput;
 }
 
+size_t OptimizerEngineStageData::getEvaluationCacheSize() const
+{
+    return mEvaluationCacheSize;
+}
+void OptimizerEngineStageData::setEvaluationCacheSize(const size_t& aInput)
+{
+    mEvaluationCacheSize = aInput;
+}
+
+size_t OptimizerEngineStageData::getCheckpointFrequency() const
+{
+    return mCheckpointFrequency;
+}
+void OptimizerEngineStageData::setCheckpointFrequency(const size_t& aInput)
+{
+    mCheckpointFrequency = aInput;
+}
+
+bool OptimizerEngineStageData::getRestartFromCheckpoint() const
+{
+    return mRestartFromCheckpoint;
+}
+void OptimizerEngineStageData::setRestartFromCheckpoint(const bool& aInput)
+{
+    mRestartFromCheckpoint = aInput;
+}
+
+/******************************************************************************/
+std::string batch_argument_name(const std::string & aName, const size_t & aIndex)
+/******************************************************************************/
+{
+    return (aName + "_" + std::to_string(aIndex));
+}
+
 } //namespace Plato
@@ -58,6 +58,13 @@
 namespace Plato
 {
 
+/******************************************************************************//**
+ * @brief Name of the shared data that holds column aIndex of a batch stage argument
+ * @param [in] aName shared data name of the unbatched argument, e.g. the control name
+ * @param [in] aIndex column index within the batch
+**********************************************************************************/
+std::string batch_argument_name(const std::string & aName, const size_t & aIndex);
+
 class OptimizerEngineStageData : public Plato::InputData
 {
 public:
@@ -293,6 +300,14 @@ public:
     void setObjectiveGradientOutputName(const std::string & aInput);
     std::string getObjectiveGradientStageName() const;
     void setObjectiveGradientStageName(const std::string & aInput);
+    std::string getObjectiveValueAndGradientStageName() const;
+    void setObjectiveValueAndGradientStageName(const std::string & aInput);
+    std::string getObjectiveBatchValueStageName() const;
+    void setObjectiveBatchValueStageName(const std::string & aInput);
+    std::string getObjectiveBatchGradientStageName() const;
+    void setObjectiveBatchGradientStageName(const std::string & aInput);
+    size_t getObjectiveBatchSize() const;
+    void setObjectiveBatchSize(const size_t & aInput);
 
     std::string getInitializationStageName() const;
     void setInitializationStageName(const std::string & aInput);
@@ -440,6 +455,14 @@ public:
     size_t getProblemUpdateFrequency() const;
     void setProblemUpdateFrequency(const size_t& aInput);
 
+    size_t getEvaluationCacheSize() const;
+    void setEvaluationCacheSize(const size_t& aInput);
+
+    size_t getCheckpointFrequency() const;
+    void setCheckpointFrequency(const size_t& aInput);
+    bool getRestartFromCheckpoint() const;
+    void setRestartFromCheckpoint(const bool& aInput);
+
 private:
     bool mMeanNorm;
     bool mCheckGradient;
@@ -449,6 +472,7 @@ private:
     bool mOutputDiagnosticsToFile;
     bool mHaveHessian;
     bool mDisablePostSmoothing;
+    bool mRestartFromCheckpoint;
 
     int mGCMMAMaxInnerIterations;
     double mInitialMovingAsymptoteScaleFactor;
@@ -479,6 +503,9 @@ private:
 
     size_t mMaxNumIterations;
     size_t mProblemUpdateFrequency;
+    size_t mEvaluationCacheSize;
+    size_t mCheckpointFrequency;
+    size_t mObjectiveBatchSize;
 
     int mDerivativeCheckerFinalSuperscript;
     int mDerivativeCheckerInitialSuperscript;
@@ -502,6 +529,9 @@ private:
     std::string mObjectiveValueStageName;
     std::string mObjectiveHessianStageName;
     std::string mObjectiveGradientStageName;
+    std::string mObjectiveValueAndGradientStageName;
+    std::string mObjectiveBatchValueStageName;
+    std::string mObjectiveBatchGradientStageName;
 
     std::vector<double> mInitialGuess;
     std::vector<double> mLowerBoundValues;
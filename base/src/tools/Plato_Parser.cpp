@@ -62,6 +62,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <cstddef>
+#include <limits>
+#include <fstream>
 
 #include "Plato_Exceptions.hpp"
 #include "Plato_OperationInputDataMng.hpp"
@@ -71,6 +73,79 @@
 namespace Plato
 {
 
+namespace
+{
+
+std::shared_ptr<te_expr> compile_expression(const std::string & aExpr,
+                                            const std::vector<te_variable> & aVariables,
+                                            const std::string & aSource)
+{
+    int error = 0;
+    te_expr *tExpr = te_compile(aExpr.c_str(), aVariables.data(), aVariables.size(), &error);
+    if( tExpr == nullptr )
+    {
+        std::stringstream ss;
+        ss << "Fatal error:  failed to evaluate expression: '" << aSource << "'.";
+        throw Plato::ParsingException(ss.str());
+    }
+    return std::shared_ptr<te_expr>(tExpr, te_free);
+}
+
+}
+
+MathExpression::MathExpression(const std::string & aExpression, const std::vector<std::string> & aVariableNames) :
+  mExpression(),
+  mNames(aVariableNames),
+  mValues(aVariableNames.size(), 0.0)
+{
+    // tinyexpr requires lowercase.  mNames and mValues are never resized after
+    // this, so the pointers bound into the compiled expression stay valid.
+    std::vector<te_variable> tVariables;
+    for( size_t tIndex = 0; tIndex < mNames.size(); tIndex++ )
+    {
+        std::transform(mNames[tIndex].begin(), mNames[tIndex].end(), mNames[tIndex].begin(), ::tolower);
+        tVariables.push_back({mNames[tIndex].c_str(), &mValues[tIndex]});
+    }
+
+    std::string tExpr(aExpression);
+    std::transform(tExpr.begin(), tExpr.end(), tExpr.begin(), ::tolower);
+    mExpression = compile_expression(tExpr, tVariables, aExpression);
+}
+
+void
+MathExpression::setVariable(const std::string & aVarName, double aVarValue)
+{
+    std::string tName(aVarName);
+    std::transform(tName.begin(), tName.end(), tName.begin(), ::tolower);
+    auto tIterator = std::find(mNames.begin(), mNames.end(), tName);
+    if( tIterator == mNames.end() )
+    {
+        std::stringstream ss;
+        ss << "MathExpression: variable '" << aVarName << "' is not bound to this expression.";
+        throw Plato::ParsingException(ss.str());
+    }
+    mValues[std::distance(mNames.begin(), tIterator)] = aVarValue;
+}
+
+double
+MathExpression::evaluate() const
+{
+    return te_eval(mExpression.get());
+}
+
+double
+MathExpression::evaluate(const std::vector<double> & aVarValues)
+{
+    if( aVarValues.size() != mValues.size() )
+    {
+        std::stringstream ss;
+        ss << "MathExpression: expected " << mValues.size() << " variable values, given " << aVarValues.size() << ".";
+        throw Plato::ParsingException(ss.str());
+    }
+    std::copy(aVarValues.begin(), aVarValues.end(), mValues.begin());
+    return this->evaluate();
+}
+
 void 
 MathParser::addArrays(const decltype(mArrays)& aArrays)
 {
@@ -165,21 +240,16 @@ MathParser::compute(std::string aExpr)
     // tinyexpr requires lowercase.
     std::transform(tSubExpr.begin(), tSubExpr.end(), tSubExpr.begin(), ::tolower);
 
-    int error;
-    te_expr *tExpr = te_compile(tSubExpr.c_str(), mVariables.data(), mVariables.size(), &error);
- 
-    if( tExpr )
-    {
-        double tVal = te_eval(tExpr);
-        tRetval << tVal;
-    }
-    else
+    // variables are bound by address, so a cached expression sees the current values.
+    auto tCompiled = mCompiled.find(tSubExpr);
+    if( tCompiled == mCompiled.end() )
     {
-        std::stringstream ss;
-        ss << "Fatal error:  failed to evaluate expression: '" << aExpr << "'.";
-        throw Plato::ParsingException(ss.str());
+        auto tExpr = compile_expression(tSubExpr, mVariables, aExpr);
+        tCompiled = mCompiled.emplace(tSubExpr, tExpr).first;
     }
-    te_free(tExpr);
+
+    double tVal = te_eval(tCompiled->second.get());
+    tRetval << tVal;
     return tRetval.str();
 }
 
@@ -206,14 +276,68 @@ InputData
 PugiParser::parseFile(const std::string& filename)
 {
     auto tInput = std::make_shared<pugi::xml_document>();
-    pugi::xml_parse_result tResult = tInput->load_file(filename.c_str());
+    load(*tInput, filename);
+    return read(tInput);
+}
+
+void
+PugiParser::load(pugi::xml_document & aDocument, const std::string & aFileName)
+{
+    pugi::xml_parse_result tResult;
+    if(mComm == MPI_COMM_NULL)
+    {
+        tResult = aDocument.load_file(aFileName.c_str());
+    }
+    else
+    {
+        // every rank parses the same bytes, so a parse failure is seen by all ranks.
+        const std::string tContents = PugiParser::readFile(aFileName, mComm);
+        tResult = aDocument.load_buffer(tContents.data(), tContents.size());
+    }
     if(!tResult)
     {
         std::stringstream ss;
-        ss << "Error loading file '" << filename << "'.";
+        ss << "Error loading file '" << aFileName << "'.";
         throw Plato::ParsingException(ss.str());
     }
-    return read(tInput);
+}
+
+std::string
+PugiParser::readFile(const std::string & aFileName, MPI_Comm aComm)
+{
+    int tRank = 0;
+    MPI_Comm_rank(aComm, &tRank);
+
+    std::string tContents;
+    long long tSize = -1;
+    if(tRank == 0)
+    {
+        std::ifstream tFile(aFileName.c_str(), std::ios::in | std::ios::binary);
+        if(tFile)
+        {
+            std::ostringstream tBuffer;
+            tBuffer << tFile.rdbuf();
+            tContents = tBuffer.str();
+            tSize = static_cast<long long>(tContents.size());
+        }
+    }
+
+    MPI_Bcast(&tSize, 1, MPI_LONG_LONG, 0, aComm);
+    if(tSize < 0)
+    {
+        std::stringstream ss;
+        ss << "Error loading file '" << aFileName << "'.";
+        throw Plato::ParsingException(ss.str());
+    }
+
+    tContents.resize(tSize);
+    const long long tMaxCount = std::numeric_limits<int>::max();
+    for(long long tOffset = 0; tOffset < tSize; tOffset += tMaxCount)
+    {
+        const int tCount = static_cast<int>(std::min(tMaxCount, tSize - tOffset));
+        MPI_Bcast(&tContents[tOffset], tCount, MPI_CHAR, 0, aComm);
+    }
+    return tContents;
 }
 
 InputData 
@@ -223,7 +347,9 @@ PugiParser::parseString(const std::string& inputString)
     pugi::xml_parse_result tResult = tInput->load_string(inputString.c_str());
     if(!tResult)
     {
-        //throw
+        std::stringstream ss;
+        ss << "Error parsing input string: " << tResult.description() << ".";
+        throw Plato::ParsingException(ss.str());
     }
     return read(tInput);
 }
@@ -255,13 +381,7 @@ PugiParser::preProcess(std::shared_ptr<pugi::xml_document> doc)
     {
         std::string tFilename  = tIncludeNode.attribute("filename").value();
         pugi::xml_document tInclude;
-        pugi::xml_parse_result tResult = tInclude.load_file(tFilename.c_str());
-        if(!tResult)
-        {
-            std::stringstream ss;
-            ss << "Error loading file '" << tFilename << "'.";
-            throw Plato::ParsingException(ss.str());
-        }
+        load(tInclude, tFilename);
         for( auto tNode = tInclude.first_child(); tNode; tNode = tNode.next_sibling() )
         {
             doc->insert_copy_before(tNode, tIncludeNode);
@@ -693,7 +813,7 @@ PugiParser::addChildren(const pugi::xml_node& node, InputData& inputData)
 {
     for (pugi::xml_node& child: node.children())
     {
-      if( std::string(child.child_value()) != "" )
+      if( *child.child_value() != '\0' )
       {
         inputData.add<std::string>(child.name(),child.child_value());
       } 
@@ -723,9 +843,9 @@ std::string String(const Plato::InputData & aNode, const std::string & aFieldNam
 /******************************************************************************/
 {
     std::string tStrVal;
-    if( aNode.size<std::string>(aFieldName) )
+    if( const std::string* tValue = aNode.view<std::string>(aFieldName) )
     {
-        tStrVal = aNode.get<std::string>(aFieldName);
+        tStrVal = *tValue;
     } else return tStrVal;
 
     if(aToUpper == true)
@@ -758,10 +878,10 @@ Plato::InputData InputData(Plato::InputData & aNode, const std::string & aFieldN
 int Int(const Plato::InputData & aNode, const std::string & aFieldname, int aDefaultValue)
 /******************************************************************************/
 {
-    if( aNode.size<std::string>(aFieldname) )
+    if( const std::string* tValue = aNode.view<std::string>(aFieldname) )
     {
       const int tBase = 10;
-      return std::strtol(aNode.get<std::string>(aFieldname).c_str(), nullptr, tBase);
+      return std::strtol(tValue->c_str(), nullptr, tBase);
     }
     else
     {
@@ -773,12 +893,11 @@ std::vector<double> Doubles(const Plato::InputData & aInputData, const std::stri
 /******************************************************************************/
 {
     std::vector<double> tValues;
-    auto tStrValues = aInputData.getByName<std::string>(aKeyword);
-    for( auto tStrValue : tStrValues )
+    aInputData.forEach<std::string>(aKeyword, [&tValues](const std::string & aStrValue)
     {
-        double tValue = std::strtold(tStrValue.c_str(), nullptr);
+        double tValue = std::strtold(aStrValue.c_str(), nullptr);
         tValues.push_back(tValue);
-    }
+    });
     return (tValues);
 }
 /******************************************************************************/
@@ -798,8 +917,8 @@ std::vector<int> Ints(const Plato::InputData & aInputData, const std::string & a
 double Double(const Plato::InputData & aNode, const std::string & aFieldname)
 /******************************************************************************/
 {
-    if( aNode.size<std::string>(aFieldname) ){
-      return atof(aNode.get<std::string>(aFieldname).c_str());
+    if( const std::string* tValue = aNode.view<std::string>(aFieldname) ){
+      return atof(tValue->c_str());
     } else {
       return 0.0;
     }
@@ -808,9 +927,8 @@ double Double(const Plato::InputData & aNode, const std::string & aFieldname)
 bool Bool(const Plato::InputData & aNode, const std::string & aFieldname)
 /******************************************************************************/
 {
-    if( aNode.size<std::string>(aFieldname) ){
-      std::string strval = aNode.get<std::string>(aFieldname);
-      return Parse::boolFromString(strval);
+    if( const std::string* tValue = aNode.view<std::string>(aFieldname) ){
+      return Parse::boolFromString(*tValue);
     } else {
       return false;
     }
@@ -1135,6 +1253,26 @@ void parseStageData(const Plato::InputData & aStageNode, Plato::StageInputDataMn
 
     aStageInputDataMng.add(tStageName, tSharedDataNameInputs, tSharedDataNameOutputs);
 
+    // Transmit all shared data at stage and operation level boundaries in one exchange
+    bool tBatchTransmit = Plato::Get::Bool(aStageNode, "BatchTransmit");
+    aStageInputDataMng.setBatchTransmit(tStageName, tBatchTransmit);
+
+    // How often ranks synchronize to check for exceptions: once per operation level
+    // (default), after every operation, once per stage, or after every argument
+    // import/export (debugging)
+    std::string tExceptionCheck = Plato::Get::String(aStageNode, "ExceptionCheck", true);
+    if(tExceptionCheck.empty() == false)
+    {
+        if(tExceptionCheck != "LEVEL" && tExceptionCheck != "OPERATION" && tExceptionCheck != "STAGE" && tExceptionCheck != "ARGUMENT")
+        {
+            std::stringstream tMsg;
+            tMsg << "Stage '" << tStageName << "': unknown ExceptionCheck '" << tExceptionCheck
+                 << "'. Options are Level, Operation, Stage, or Argument.";
+            throw Plato::ParsingException(tMsg.str());
+        }
+        aStageInputDataMng.setExceptionCheck(tStageName, tExceptionCheck);
+    }
+
     Plato::Parse::parseStageOperations(aStageNode, aStageInputDataMng);
 }
 
@@ -1384,6 +1522,36 @@ void parseObjectiveStagesData(const Plato::InputData & aObjectiveNode, Plato::Op
         aOptimizerStageData.setObjectiveHessianStageName(tObjectiveHessianStageName);
         aOptimizerStageData.setObjectiveHessianOutputName(tOutputSharedDataHessianName);
     }
+
+    // optional stage that computes the objective value and gradient in one pass; it sets both the
+    // ValueName and GradientName shared data, so the separate stages above remain the fallback
+    std::string tObjectiveValueAndGradientStageName = Plato::Get::String(aObjectiveNode, "ValueAndGradientStageName");
+    if(tObjectiveValueAndGradientStageName.empty() == false)
+    {
+        aOptimizerStageData.setObjectiveValueAndGradientStageName(tObjectiveValueAndGradientStageName);
+    }
+
+    // optional stages that evaluate BatchSize controls per execution; column k of the batch is
+    // passed in the shared data named batch_argument_name(<control or output name>, k)
+    std::string tObjectiveBatchValueStageName = Plato::Get::String(aObjectiveNode, "BatchValueStageName");
+    if(tObjectiveBatchValueStageName.empty() == false)
+    {
+        aOptimizerStageData.setObjectiveBatchValueStageName(tObjectiveBatchValueStageName);
+    }
+    std::string tObjectiveBatchGradientStageName = Plato::Get::String(aObjectiveNode, "BatchGradientStageName");
+    if(tObjectiveBatchGradientStageName.empty() == false)
+    {
+        aOptimizerStageData.setObjectiveBatchGradientStageName(tObjectiveBatchGradientStageName);
+    }
+    if(aObjectiveNode.size<std::string>("BatchSize"))
+    {
+        int tBatchSize = Plato::Get::Int(aObjectiveNode, "BatchSize");
+        if(tBatchSize < 1)
+        {
+            throw Plato::ParsingException("Parse Objective Stages Data: BatchSize must be a positive integer.");
+        }
+        aOptimizerStageData.setObjectiveBatchSize(tBatchSize);
+    }
 }
 
 /******************************************************************************/
@@ -1540,6 +1708,36 @@ void parseOptimizerOptions(const Plato::InputData & aOptimizerNode, Plato::Optim
             int tProblemUpdateFrequency = Plato::Get::Int(tOptionsNode, "ProblemUpdateFrequency");
             aOptimizerEngineStageData.setProblemUpdateFrequency(tProblemUpdateFrequency);
         }
+        if(tOptionsNode.size<std::string>("EvaluationCacheSize"))
+        {
+            int tEvaluationCacheSize = Plato::Get::Int(tOptionsNode, "EvaluationCacheSize");
+            aOptimizerEngineStageData.setEvaluationCacheSize(tEvaluationCacheSize);
+        }
+        if(tOptionsNode.size<std::string>("CheckpointFrequency"))
+        {
+            int tCheckpointFrequency = Plato::Get::Int(tOptionsNode, "CheckpointFrequency");
+            aOptimizerEngineStageData.setCheckpointFrequency(tCheckpointFrequency);
+        }
+        if(tOptionsNode.size<std::string>("RestartFromCheckpoint"))
+        {
+            bool tRestartFromCheckpoint = Plato::Get::Bool(tOptionsNode, "RestartFromCheckpoint");
+            aOptimizerEngineStageData.setRestartFromCheckpoint(tRestartFromCheckpoint);
+        }
+        const bool tUsesCheckpoints = aOptimizerEngineStageData.getCheckpointFrequency() > static_cast<size_t>(0)
+                || aOptimizerEngineStageData.getRestartFromCheckpoint();
+        if(tUsesCheckpoints)
+        {
+            // only these optimizers write and read checkpoints; the others would silently ignore the options
+            const std::string tPackage = Plato::Get::String(aOptimizerNode, "Package");
+            const std::vector<std::string> tSupported = {"OC", "MMA", "GCMMA", "KSUC", "KSBC"};
+            if(std::find(tSupported.begin(), tSupported.end(), tPackage) == tSupported.end())
+            {
+                std::ostringstream tMsg;
+                tMsg << "\n\n ********** PLATO ERROR: CheckpointFrequency and RestartFromCheckpoint are not supported by the '"
+                     << tPackage << "' optimizer. Supported optimizers are OC, MMA, GCMMA, KSUC and KSBC. **********\n\n";
+                throw Plato::ParsingException(tMsg.str());
+            }
+        }
         if(tOptionsNode.size<std::string>("MaxNumAugLagSubProbIter"))
         {
             int tMaxNumAugLagSubProbIter = Plato::Get::Int(tOptionsNode, "MaxNumAugLagSubProbIter");
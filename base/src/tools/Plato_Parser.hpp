@@ -50,6 +50,7 @@
 #ifndef SRC_PARSER_H_
 #define SRC_PARSER_H_
 
+#include <mpi.h>
 #include <string>
 #include <vector>
 #include "math_parser/tinyexpr.h"
@@ -63,12 +64,38 @@ class StageInputDataMng;
 class OperationInputDataMng;
 class OptimizerEngineStageData;
 
+/*! A tinyexpr expression that is compiled once and evaluated many times.
+ *
+ *  The variables named at construction are bound to storage owned by this object;
+ *  set their values with setVariable() or pass them all to evaluate().
+ */
+class MathExpression {
+    std::shared_ptr<te_expr> mExpression;
+    std::vector<std::string> mNames;
+    std::vector<double> mValues;
+  public:
+    MathExpression(const std::string & aExpression, const std::vector<std::string> & aVariableNames = {});
+
+    // the compiled expression points into mValues, so copies would alias this object
+    MathExpression(const MathExpression&) = delete;
+    MathExpression& operator=(const MathExpression&) = delete;
+    MathExpression(MathExpression&&) = default;
+    MathExpression& operator=(MathExpression&&) = default;
+
+    void setVariable(const std::string & aVarName, double aVarValue);
+    double evaluate() const;
+    double evaluate(const std::vector<double> & aVarValues);
+};
+
 class MathParser {
     std::vector<te_variable> mVariables;
     std::vector<std::shared_ptr<double>> mValues;
     std::vector<std::shared_ptr<std::string>> mNames;
 
     std::map<std::string,std::vector<std::string>> mArrays;
+
+    // compiled expressions, keyed by the (lowercase, array-substituted) expression
+    std::map<std::string,std::shared_ptr<te_expr>> mCompiled;
   public:  
     void addVariable(std::string aVarName, std::string aVarValue);
     void addArrays(const decltype(mArrays)&);
@@ -86,6 +113,10 @@ class Parser {
 
 class PugiParser : public Parser {
   public:
+    PugiParser() : mComm(MPI_COMM_NULL) {}
+
+    //! Files (including 'include' files) are read by rank 0 of aComm and broadcast to the other ranks.
+    explicit PugiParser(MPI_Comm aComm) : mComm(aComm) {}
     ~PugiParser(){}
     Plato::InputData parseFile(const std::string& fileName);
     Plato::InputData parseString(const std::string& inputString);
@@ -95,11 +126,16 @@ class PugiParser : public Parser {
     static std::string findReplace(std::string aString, std::string aFind, std::string aReplace);
     static std::vector<std::string> tokenize(std::string aString, const char aDelimiter);
 
+    //! Read aFileName on rank 0 of aComm and broadcast its contents.  Collective on aComm.
+    static std::string readFile(const std::string & aFileName, MPI_Comm aComm);
 
   private:
     Plato::InputData read(std::shared_ptr<pugi::xml_document> doc);
     void addChildren(const pugi::xml_node& node, InputData& inputData);
     void preProcess(std::shared_ptr<pugi::xml_document> doc);
+    void load(pugi::xml_document & aDocument, const std::string & aFileName);
+
+    MPI_Comm mComm;
 
     class ForWalker : public pugi::xml_tree_walker
     {
@@ -0,0 +1,295 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_RankBalance.cpp
+ *
+ */
+
+#include "Plato_RankBalance.hpp"
+
+#include <cmath>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+namespace Plato
+{
+
+/******************************************************************************/
+RankBalance::RankBalance() :
+        mIsEnabled(false),
+        mComm(MPI_COMM_NULL),
+        mPerformerID(0),
+        mNumPerformerComms(1),
+        mNumIterations(0),
+        mNumIterationsDone(0),
+        mIterationStageName(),
+        mFileName(),
+        mWindowBegin(-1),
+        mBusyBegin(-1),
+        mBusyTime(0),
+        mReport()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+RankBalance::~RankBalance()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+void RankBalance::enable(const MPI_Comm & aComm,
+                         int aPerformerID,
+                         int aNumPerformerComms,
+                         int aNumIterations,
+                         const std::string & aIterationStageName,
+                         const std::string & aFileName)
+/******************************************************************************/
+{
+    mComm = aComm;
+    mPerformerID = aPerformerID;
+    mNumPerformerComms = std::max(aNumPerformerComms, 1);
+    mNumIterations = std::max(aNumIterations, 1);
+    mNumIterationsDone = 0;
+    mIterationStageName = aIterationStageName;
+    mFileName = aFileName;
+    mWindowBegin = -1;
+    mBusyBegin = -1;
+    mBusyTime = 0;
+    mReport.clear();
+    mIsEnabled = true;
+}
+
+/******************************************************************************/
+bool RankBalance::isEnabled() const
+/******************************************************************************/
+{
+    return mIsEnabled;
+}
+
+/******************************************************************************/
+void RankBalance::beginBusy()
+/******************************************************************************/
+{
+    if(mIsEnabled && mWindowBegin >= 0)
+    {
+        mBusyBegin = MPI_Wtime();
+    }
+}
+
+/******************************************************************************/
+void RankBalance::endBusy()
+/******************************************************************************/
+{
+    if(mIsEnabled && mBusyBegin >= 0)
+    {
+        mBusyTime += MPI_Wtime() - mBusyBegin;
+        mBusyBegin = -1;
+    }
+}
+
+/******************************************************************************/
+void RankBalance::beginStage()
+/******************************************************************************/
+{
+    // the measurement window opens with the first stage, after the hosted codes are set up
+    if(mIsEnabled && mWindowBegin < 0)
+    {
+        mWindowBegin = MPI_Wtime();
+    }
+}
+
+/******************************************************************************/
+void RankBalance::endStage(const std::string & aStageName)
+/******************************************************************************/
+{
+    if(mIsEnabled == false)
+    {
+        return;
+    }
+
+    // every rank executes every stage, so all ranks reach the report together
+    if(mIterationStageName.empty() || aStageName == mIterationStageName)
+    {
+        mNumIterationsDone++;
+    }
+    if(mNumIterationsDone >= mNumIterations)
+    {
+        this->writeReport();
+        mIsEnabled = false;
+    }
+}
+
+/******************************************************************************/
+const std::string & RankBalance::getReport() const
+/******************************************************************************/
+{
+    return mReport;
+}
+
+/******************************************************************************/
+std::map<int, int> RankBalance::recommendSplit(const std::map<int, double> & aWork,
+                                               const std::map<int, int> & aNumComms,
+                                               int aNumRanks)
+/******************************************************************************/
+{
+    double tTotalWork = 0;
+    for(const auto & tWork : aWork)
+    {
+        tTotalWork += tWork.second;
+    }
+
+    // ideal (fractional) rank counts are proportional to the measured work
+    std::map<int, double> tIdeal;
+    std::map<int, int> tSplit;
+    int tNumAssigned = 0;
+    for(const auto & tWork : aWork)
+    {
+        const int tNumComms = aNumComms.count(tWork.first) ? std::max(aNumComms.at(tWork.first), 1) : 1;
+        const double tShare = tTotalWork > 0 ? tWork.second / tTotalWork : 1.0 / aWork.size();
+        tIdeal[tWork.first] = tShare * aNumRanks;
+        const int tNumUnits = std::max(1, static_cast<int>(std::floor(tIdeal[tWork.first] / tNumComms)));
+        tSplit[tWork.first] = tNumUnits * tNumComms;
+        tNumAssigned += tSplit[tWork.first];
+    }
+
+    // hand out the remaining ranks, one set of comms at a time, to the performer furthest below its ideal
+    while(true)
+    {
+        int tBestID = 0;
+        bool tFound = false;
+        double tBestDeficit = 0;
+        for(const auto & tIdealRanks : tIdeal)
+        {
+            const int tNumComms = aNumComms.count(tIdealRanks.first) ? std::max(aNumComms.at(tIdealRanks.first), 1) : 1;
+            if(tNumAssigned + tNumComms > aNumRanks)
+            {
+                continue;
+            }
+            const double tDeficit = tIdealRanks.second - tSplit[tIdealRanks.first];
+            if(tFound == false || tDeficit > tBestDeficit)
+            {
+                tBestID = tIdealRanks.first;
+                tBestDeficit = tDeficit;
+                tFound = true;
+            }
+        }
+        if(tFound == false)
+        {
+            break;
+        }
+        const int tNumComms = aNumComms.count(tBestID) ? std::max(aNumComms.at(tBestID), 1) : 1;
+        tSplit[tBestID] += tNumComms;
+        tNumAssigned += tNumComms;
+    }
+    return tSplit;
+}
+
+/******************************************************************************/
+void RankBalance::writeReport()
+/******************************************************************************/
+{
+    int tMyRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(mComm, &tMyRank);
+    MPI_Comm_size(mComm, &tNumRanks);
+
+    const double tWallTime = MPI_Wtime() - mWindowBegin;
+    double tMySample[3] = {static_cast<double>(mPerformerID), static_cast<double>(mNumPerformerComms), mBusyTime};
+    std::vector<double> tSamples(3 * tNumRanks);
+    MPI_Gather(tMySample, 3, MPI_DOUBLE, tSamples.data(), 3, MPI_DOUBLE, 0, mComm);
+    if(tMyRank != 0)
+    {
+        return;
+    }
+
+    std::map<int, int> tRanks;
+    std::map<int, int> tNumComms;
+    std::map<int, double> tWork;
+    std::map<int, double> tMaxBusy;
+    for(int tRank = 0; tRank < tNumRanks; tRank++)
+    {
+        const int tID = static_cast<int>(tSamples[3 * tRank]);
+        tRanks[tID]++;
+        tNumComms[tID] = static_cast<int>(tSamples[3 * tRank + 1]);
+        tWork[tID] += tSamples[3 * tRank + 2];
+        tMaxBusy[tID] = std::max(tMaxBusy[tID], tSamples[3 * tRank + 2]);
+    }
+    std::map<int, int> tSplit = RankBalance::recommendSplit(tWork, tNumComms, tNumRanks);
+
+    std::ostringstream tReport;
+    tReport << "Plato rank balance after " << mNumIterationsDone << " iterations ("
+            << std::fixed << std::setprecision(3) << tWallTime << " s)\n";
+    tReport << std::setw(12) << "PerformerID" << std::setw(8) << "Ranks" << std::setw(16) << "Work [rank-s]"
+            << std::setw(14) << "Max busy [s]" << std::setw(14) << "Utilization" << std::setw(14) << "Recommended" << "\n";
+    for(const auto & tPerformer : tRanks)
+    {
+        const int tID = tPerformer.first;
+        const double tUtilization = tWallTime > 0 ? tWork[tID] / (tPerformer.second * tWallTime) : 0;
+        tReport << std::setw(12) << tID << std::setw(8) << tPerformer.second << std::setw(16) << tWork[tID]
+                << std::setw(14) << tMaxBusy[tID] << std::setw(13) << std::setprecision(1) << 100 * tUtilization << "%"
+                << std::setw(14) << tSplit[tID] << std::setprecision(3) << "\n";
+    }
+    tReport << "Recommended launch:";
+    for(const auto & tPerformer : tSplit)
+    {
+        tReport << (tPerformer.first == tSplit.begin()->first ? " " : " : ")
+                << "-np " << tPerformer.second << " -x PLATO_PERFORMER_ID=" << tPerformer.first << " ...";
+    }
+    tReport << "\n";
+    mReport = tReport.str();
+
+    std::cout << mReport << std::flush;
+    if(mFileName.empty() == false)
+    {
+        std::ofstream tFile(mFileName.c_str());
+        tFile << mReport;
+    }
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_RankBalance.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mpi.h>
+#include <string>
+
+namespace Plato
+{
+
+/******************************************************************************/
+//!  Measures the busy time of each performer and recommends a rank split
+/*!
+ The ranks given to each PerformerID are fixed at startup.  When enabled, each
+ rank accumulates the wall time it spends computing (hosted code operations,
+ and optimizer work between Interface::compute calls) over the first N
+ iterations.  The iteration count is the number of executions of a given stage,
+ or of any stage if none is given.  Then the busy time is gathered on rank 0,
+ which writes a report with each performer's utilization and a rank split
+ proportional to its measured work.
+ */
+/******************************************************************************/
+class RankBalance
+{
+public:
+    RankBalance();
+    ~RankBalance();
+
+    void enable(const MPI_Comm & aComm,
+                int aPerformerID,
+                int aNumPerformerComms,
+                int aNumIterations,
+                const std::string & aIterationStageName,
+                const std::string & aFileName);
+    bool isEnabled() const;
+
+    void beginBusy();
+    void endBusy();
+
+    void beginStage();
+    void endStage(const std::string & aStageName);
+
+    const std::string & getReport() const;
+
+    // recommended number of ranks for each performer ID; each count is a positive multiple of the
+    // performer's number of comms and the counts add up to aNumRanks whenever that is possible
+    static std::map<int, int> recommendSplit(const std::map<int, double> & aWork,
+                                             const std::map<int, int> & aNumComms,
+                                             int aNumRanks);
+
+private:
+    void writeReport();
+
+    bool mIsEnabled;
+    MPI_Comm mComm;
+    int mPerformerID;
+    int mNumPerformerComms;
+    int mNumIterations;
+    int mNumIterationsDone;
+    std::string mIterationStageName;
+    std::string mFileName;
+
+    double mWindowBegin;
+    double mBusyBegin;
+    double mBusyTime;
+    std::string mReport;
+
+private:
+    RankBalance(const Plato::RankBalance & aRhs);
+    Plato::RankBalance & operator=(const Plato::RankBalance & aRhs);
+};
+
+}
@@ -56,6 +56,8 @@ namespace Plato
 
 StageInputDataMng::StageInputDataMng() :
         mStageNames(),
+        mBatchTransmit(),
+        mExceptionCheck(),
         mOperationInputs(),
         mSharedDataMap()
 {
@@ -373,4 +375,34 @@ const Plato::OperationInputDataMng & StageInputDataMng::getOperationInputData(co
     return (tIterator->second[aOperationIndex]);
 }
 
+bool StageInputDataMng::getBatchTransmit(const std::string & aStageName) const
+{
+    std::map<std::string, bool>::const_iterator tIterator = mBatchTransmit.find(aStageName);
+    if(tIterator == mBatchTransmit.end())
+    {
+        return (false);
+    }
+    return (tIterator->second);
+}
+
+void StageInputDataMng::setBatchTransmit(const std::string & aStageName, const bool & aBatchTransmit)
+{
+    mBatchTransmit[aStageName] = aBatchTransmit;
+}
+
+std::string StageInputDataMng::getExceptionCheck(const std::string & aStageName) const
+{
+    std::map<std::string, std::string>::const_iterator tIterator = mExceptionCheck.find(aStageName);
+    if(tIterator == mExceptionCheck.end())
+    {
+        return ("LEVEL");
+    }
+    return (tIterator->second);
+}
+
+void StageInputDataMng::setExceptionCheck(const std::string & aStageName, const std::string & aExceptionCheck)
+{
+    mExceptionCheck[aStageName] = aExceptionCheck;
+}
+
 }
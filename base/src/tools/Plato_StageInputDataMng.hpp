@@ -101,8 +101,16 @@ public:
     void addOperationInputData(const std::string & aStageName, const Plato::OperationInputDataMng & aOperationInputData);
     void addOperationInputData(const std::string & aStageName, const std::vector<Plato::OperationInputDataMng> & aOperationInputData);
 
+    bool getBatchTransmit(const std::string & aStageName) const;
+    void setBatchTransmit(const std::string & aStageName, const bool & aBatchTransmit);
+
+    std::string getExceptionCheck(const std::string & aStageName) const;
+    void setExceptionCheck(const std::string & aStageName, const std::string & aExceptionCheck);
+
 private:
     std::vector<std::string> mStageNames;
+    std::map<std::string, bool> mBatchTransmit;
+    std::map<std::string, std::string> mExceptionCheck;
     std::map<std::string, std::vector<Plato::OperationInputDataMng>> mOperationInputs;
     std::map<std::string, std::pair<std::vector<std::string>, std::vector<std::string>>> mSharedDataMap;
 
@@ -0,0 +1,486 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_StageRecorder.cpp
+ *
+ */
+
+#include "Plato_StageRecorder.hpp"
+#include "Plato_Exceptions.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+namespace Plato
+{
+
+namespace
+{
+
+/******************************************************************************/
+std::vector<std::string> split_record(const std::string & aLine)
+/******************************************************************************/
+{
+    std::vector<std::string> tFields;
+    std::stringstream tStream(aLine);
+    std::string tField;
+    while(std::getline(tStream, tField, '\t'))
+    {
+        tFields.push_back(tField);
+    }
+    return tFields;
+}
+
+}
+
+/******************************************************************************/
+std::string recording_layout_name(Plato::data::layout_t aLayout)
+/******************************************************************************/
+{
+    switch(aLayout)
+    {
+        case Plato::data::layout_t::SCALAR_FIELD:
+            return "NODAL FIELD";
+        case Plato::data::layout_t::ELEMENT_FIELD:
+            return "ELEMENT FIELD";
+        default:
+            return "GLOBAL";
+    }
+}
+
+/******************************************************************************/
+Plato::data::layout_t recording_layout(const std::string & aLayoutName)
+/******************************************************************************/
+{
+    if(aLayoutName == "NODAL FIELD")
+    {
+        return Plato::data::layout_t::SCALAR_FIELD;
+    }
+    else if(aLayoutName == "ELEMENT FIELD")
+    {
+        return Plato::data::layout_t::ELEMENT_FIELD;
+    }
+    return Plato::data::layout_t::SCALAR;
+}
+
+/******************************************************************************/
+void ComputeTimes::add(double aSeconds)
+/******************************************************************************/
+{
+    mMin = mCount == 0 ? aSeconds : std::min(mMin, aSeconds);
+    mMax = mCount == 0 ? aSeconds : std::max(mMax, aSeconds);
+    mTotal += aSeconds;
+    mCount++;
+}
+
+/******************************************************************************/
+void ComputeTimes::merge(const Plato::ComputeTimes & aOther)
+/******************************************************************************/
+{
+    if(mCount == 0)
+    {
+        *this = aOther;
+        return;
+    }
+    mCount = std::max(mCount, aOther.mCount);
+    mTotal = std::max(mTotal, aOther.mTotal);
+    mMin = std::max(mMin, aOther.mMin);
+    mMax = std::max(mMax, aOther.mMax);
+}
+
+/******************************************************************************/
+StageRecorder::StageRecorder() :
+        mIsEnabled(false),
+        mIsDriver(false),
+        mComm(MPI_COMM_NULL),
+        mPerformerName(),
+        mFileName(),
+        mOwnedIDs(),
+        mFieldNames(),
+        mFields(),
+        mStageNames(),
+        mStageIndices(),
+        mStageRuns(),
+        mTransmits(),
+        mOperationNames(),
+        mComputeTimes()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+StageRecorder::~StageRecorder()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+void StageRecorder::enable(const MPI_Comm & aComm, const std::string & aPerformerName, const std::string & aFileName)
+/******************************************************************************/
+{
+    mComm = aComm;
+    mPerformerName = aPerformerName;
+    mFileName = aFileName;
+    mIsEnabled = true;
+}
+
+/******************************************************************************/
+bool StageRecorder::isEnabled() const
+/******************************************************************************/
+{
+    return mIsEnabled;
+}
+
+/******************************************************************************/
+void StageRecorder::recordOwnedIDs(Plato::data::layout_t aLayout, int aNumOwnedIDs)
+/******************************************************************************/
+{
+    if(mIsEnabled)
+    {
+        mOwnedIDs[Plato::recording_layout_name(aLayout)] = aNumOwnedIDs;
+    }
+}
+
+/******************************************************************************/
+void StageRecorder::recordField(const std::string & aName, Plato::data::layout_t aLayout, int aSize, int aNumComponents)
+/******************************************************************************/
+{
+    if(mIsEnabled && mFields.count(aName) == 0)
+    {
+        mFieldNames.push_back(aName);
+        const std::string tLayout = Plato::recording_layout_name(aLayout);
+        mFields[aName] = std::make_pair(tLayout, tLayout == "GLOBAL" ? aSize : aNumComponents);
+    }
+}
+
+/******************************************************************************/
+void StageRecorder::recordDriver()
+/******************************************************************************/
+{
+    mIsDriver = true;
+}
+
+/******************************************************************************/
+void StageRecorder::recordStage(const std::string & aStageName, const std::vector<std::string> & aTransmits)
+/******************************************************************************/
+{
+    if(mIsEnabled)
+    {
+        auto tIterator = mStageIndices.find(aStageName);
+        if(tIterator == mStageIndices.end())
+        {
+            tIterator = mStageIndices.insert(std::make_pair(aStageName, static_cast<int>(mStageNames.size()))).first;
+            mStageNames.push_back(aStageName);
+            mTransmits[aStageName] = aTransmits;
+        }
+        if(mStageRuns.empty() || mStageRuns.back().first != tIterator->second)
+        {
+            mStageRuns.push_back(std::make_pair(tIterator->second, 0));
+        }
+        mStageRuns.back().second++;
+    }
+}
+
+/******************************************************************************/
+void StageRecorder::recordCompute(const std::string & aOperationName, double aSeconds)
+/******************************************************************************/
+{
+    if(mIsEnabled)
+    {
+        if(mComputeTimes.count(aOperationName) == 0)
+        {
+            mOperationNames.push_back(aOperationName);
+        }
+        mComputeTimes[aOperationName].add(aSeconds);
+    }
+}
+
+/******************************************************************************/
+std::string StageRecorder::serialize() const
+/******************************************************************************/
+{
+    std::ostringstream tRecord;
+    tRecord << std::setprecision(9);
+    tRecord << "P\t" << mPerformerName << "\n";
+    if(mIsDriver)
+    {
+        tRecord << "D\n";
+    }
+    for(const auto & tOwnedIDs : mOwnedIDs)
+    {
+        tRecord << "I\t" << tOwnedIDs.first << "\t" << tOwnedIDs.second << "\n";
+    }
+    for(const std::string & tOperationName : mOperationNames)
+    {
+        const Plato::ComputeTimes & tTimes = mComputeTimes.at(tOperationName);
+        tRecord << "C\t" << tOperationName << "\t" << tTimes.mCount << "\t" << tTimes.mTotal
+                << "\t" << tTimes.mMin << "\t" << tTimes.mMax << "\n";
+    }
+    return tRecord.str();
+}
+
+/******************************************************************************/
+void StageRecorder::finalize()
+/******************************************************************************/
+{
+    if(mIsEnabled == false)
+    {
+        return;
+    }
+    mIsEnabled = false;
+
+    int tMyRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(mComm, &tMyRank);
+    MPI_Comm_size(mComm, &tNumRanks);
+
+    const std::string tMyRecord = this->serialize();
+    int tMyLength = tMyRecord.size();
+    std::vector<int> tLengths(tNumRanks);
+    MPI_Gather(&tMyLength, 1, MPI_INT, tLengths.data(), 1, MPI_INT, 0, mComm);
+
+    std::vector<int> tOffsets(tNumRanks, 0);
+    for(int tRank = 1; tRank < tNumRanks; tRank++)
+    {
+        tOffsets[tRank] = tOffsets[tRank - 1] + tLengths[tRank - 1];
+    }
+    std::vector<char> tRecords(tNumRanks > 0 ? tOffsets.back() + tLengths.back() : 0);
+    MPI_Gatherv(tMyRecord.data(), tMyLength, MPI_CHAR,
+                tRecords.data(), tLengths.data(), tOffsets.data(), MPI_CHAR, 0, mComm);
+    if(tMyRank != 0)
+    {
+        return;
+    }
+
+    // merge the ranks' records per performer
+    std::vector<std::string> tPerformerNames;
+    std::map<std::string, int> tPerformerRanks;
+    std::map<std::string, std::map<std::string, int>> tPerformerIDs;
+    std::map<std::string, std::vector<std::string>> tOperationNames;
+    std::map<std::string, std::map<std::string, Plato::ComputeTimes>> tComputeTimes;
+    std::string tDriver;
+    for(int tRank = 0; tRank < tNumRanks; tRank++)
+    {
+        std::stringstream tRecord(std::string(tRecords.data() + tOffsets[tRank], tLengths[tRank]));
+        std::string tLine;
+        std::string tPerformerName;
+        while(std::getline(tRecord, tLine))
+        {
+            std::vector<std::string> tFields = split_record(tLine);
+            if(tFields.empty())
+            {
+                continue;
+            }
+            if(tFields[0] == "P")
+            {
+                tPerformerName = tFields.size() > 1 ? tFields[1] : std::string();
+                if(tPerformerRanks[tPerformerName]++ == 0)
+                {
+                    tPerformerNames.push_back(tPerformerName);
+                }
+            }
+            else if(tFields[0] == "D")
+            {
+                tDriver = tPerformerName;
+            }
+            else if(tFields[0] == "I")
+            {
+                tPerformerIDs[tPerformerName][tFields[1]] += std::stoi(tFields[2]);
+            }
+            else if(tFields[0] == "C" && tFields.size() == 6u)
+            {
+                if(tComputeTimes[tPerformerName].count(tFields[1]) == 0)
+                {
+                    tOperationNames[tPerformerName].push_back(tFields[1]);
+                }
+                Plato::ComputeTimes tTimes;
+                tTimes.mCount = std::stoi(tFields[2]);
+                tTimes.mTotal = std::stod(tFields[3]);
+                tTimes.mMin = std::stod(tFields[4]);
+                tTimes.mMax = std::stod(tFields[5]);
+                tComputeTimes[tPerformerName][tFields[1]].merge(tTimes);
+            }
+        }
+    }
+
+    // performers that share a field layout own the same global IDs, so the largest count is the global size
+    std::map<std::string, int> tGlobalIDs;
+    for(const auto & tIDs : tPerformerIDs)
+    {
+        for(const auto & tLayoutIDs : tIDs.second)
+        {
+            tGlobalIDs[tLayoutIDs.first] = std::max(tGlobalIDs[tLayoutIDs.first], tLayoutIDs.second);
+        }
+    }
+
+    std::ofstream tFile(mFileName.c_str());
+    tFile << std::setprecision(9);
+    tFile << "version\t1\n";
+    for(const std::string & tPerformerName : tPerformerNames)
+    {
+        tFile << "performer\t" << tPerformerName << "\t" << tPerformerRanks[tPerformerName] << "\n";
+    }
+    for(const auto & tLayoutIDs : tGlobalIDs)
+    {
+        tFile << "ids\t" << tLayoutIDs.first << "\t" << tLayoutIDs.second << "\n";
+    }
+    for(const std::string & tFieldName : mFieldNames)
+    {
+        const std::string & tLayout = mFields.at(tFieldName).first;
+        const int tSize = tLayout == "GLOBAL" ? mFields.at(tFieldName).second : tGlobalIDs[tLayout] * mFields.at(tFieldName).second;
+        tFile << "field\t" << tFieldName << "\t" << tLayout << "\t" << tSize << "\n";
+    }
+    tFile << "driver\t" << tDriver << "\n";
+    for(const auto & tTransmits : mTransmits)
+    {
+        tFile << "transmits\t" << tTransmits.first;
+        for(const std::string & tFieldName : tTransmits.second)
+        {
+            tFile << "\t" << tFieldName;
+        }
+        tFile << "\n";
+    }
+    for(const std::pair<int, int> & tRun : mStageRuns)
+    {
+        tFile << "stage\t" << mStageNames[tRun.first] << "\t" << tRun.second << "\n";
+    }
+    for(const std::string & tPerformerName : tPerformerNames)
+    {
+        for(const std::string & tOperationName : tOperationNames[tPerformerName])
+        {
+            const Plato::ComputeTimes & tTimes = tComputeTimes[tPerformerName][tOperationName];
+            tFile << "compute\t" << tPerformerName << "\t" << tOperationName << "\t" << tTimes.mCount
+                  << "\t" << tTimes.mTotal << "\t" << tTimes.mMin << "\t" << tTimes.mMax << "\n";
+        }
+    }
+    std::cout << "Plato stage recording written to " << mFileName << std::endl;
+}
+
+/******************************************************************************/
+void StageRecording::read(const std::string & aFileName)
+/******************************************************************************/
+{
+    std::ifstream tFile(aFileName.c_str());
+    std::string tLine;
+    if(!tFile.good() || !std::getline(tFile, tLine) || split_record(tLine) != std::vector<std::string>{"version", "1"})
+    {
+        std::stringstream tMsg;
+        tMsg << "Plato::StageRecording: '" << aFileName << "' is not a stage recording.";
+        throw Plato::ParsingException(tMsg.str());
+    }
+
+    *this = StageRecording();
+    while(std::getline(tFile, tLine))
+    {
+        std::vector<std::string> tFields = split_record(tLine);
+        if(tFields.empty())
+        {
+            continue;
+        }
+        const std::string & tKind = tFields[0];
+        if(tKind == "performer" && tFields.size() == 3u)
+        {
+            mPerformerNames.push_back(tFields[1]);
+            mPerformerRanks[tFields[1]] = std::stoi(tFields[2]);
+        }
+        else if(tKind == "ids" && tFields.size() == 3u)
+        {
+            mGlobalIDs[tFields[1]] = std::stoi(tFields[2]);
+        }
+        else if(tKind == "field" && tFields.size() == 4u)
+        {
+            mFields.push_back({tFields[1], tFields[2], std::stoi(tFields[3])});
+        }
+        else if(tKind == "driver")
+        {
+            mDriver = tFields.size() > 1 ? tFields[1] : std::string();
+        }
+        else if(tKind == "transmits" && tFields.size() >= 2u)
+        {
+            mTransmits[tFields[1]].assign(tFields.begin() + 2, tFields.end());
+        }
+        else if(tKind == "stage" && (tFields.size() == 2u || tFields.size() == 3u))
+        {
+            const int tRepeats = tFields.size() == 3u ? std::stoi(tFields[2]) : 1;
+            if(mStages.empty() == false && mStages.back().mName == tFields[1])
+            {
+                mStages.back().mRepeats += tRepeats;
+            }
+            else
+            {
+                mStages.push_back({tFields[1], tRepeats});
+            }
+        }
+        else if(tKind == "compute" && tFields.size() == 7u)
+        {
+            Plato::ComputeTimes & tTimes = mComputeTimes[tFields[1]][tFields[2]];
+            tTimes.mCount = std::stoi(tFields[3]);
+            tTimes.mTotal = std::stod(tFields[4]);
+            tTimes.mMin = std::stod(tFields[5]);
+            tTimes.mMax = std::stod(tFields[6]);
+        }
+        else
+        {
+            std::stringstream tMsg;
+            tMsg << "Plato::StageRecording: unrecognized record '" << tLine << "' in '" << aFileName << "'.";
+            throw Plato::ParsingException(tMsg.str());
+        }
+    }
+}
+
+/******************************************************************************/
+int StageRecording::numStages() const
+/******************************************************************************/
+{
+    int tNumStages = 0;
+    for(const StageRun & tRun : mStages)
+    {
+        tNumStages += tRun.mRepeats;
+    }
+    return tNumStages;
+}
+
+}
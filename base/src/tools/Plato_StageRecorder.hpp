@@ -0,0 +1,183 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_StageRecorder.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mpi.h>
+#include <string>
+#include <vector>
+
+#include "Plato_SharedData.hpp"
+
+namespace Plato
+{
+
+// layout names as they appear in the interface definition ("NODAL FIELD", "ELEMENT FIELD", "GLOBAL")
+std::string recording_layout_name(Plato::data::layout_t aLayout);
+Plato::data::layout_t recording_layout(const std::string & aLayoutName);
+
+/******************************************************************************/
+//!  Running summary of an operation's wall times, in seconds
+/******************************************************************************/
+struct ComputeTimes
+{
+    ComputeTimes() : mCount(0), mTotal(0.0), mMin(0.0), mMax(0.0) {}
+
+    void add(double aSeconds);
+    // largest of each statistic, as for the slowest of several ranks
+    void merge(const Plato::ComputeTimes & aOther);
+    double mean() const { return mCount > 0 ? mTotal / mCount : 0.0; }
+
+    int mCount;
+    double mTotal;
+    double mMin;
+    double mMax;
+};
+
+/******************************************************************************/
+//!  Records the stage traffic of a run so it can be replayed without physics
+/*!
+ When enabled, every rank records the stages it executes, the transmits of each
+ stage, the number of global IDs it owns for each field layout, and the wall
+ time of each hosted code operation it computes.  When the run terminates the
+ records are gathered on rank 0, which writes a tab separated text file:
+
+   version    1
+   performer  <name>  <ranks>
+   ids        <layout>  <global IDs>
+   field      <name>  <layout>  <global size>
+   driver     <name>
+   transmits  <stage>  <field>...
+   stage      <name>  <repeats>
+   compute    <performer>  <operation>  <count>  <total>  <min>  <max>
+
+ Stage lines are in execution order, one per run of consecutive executions of
+ the same stage (a missing repeat count means one).  Stage names are stored
+ once and each run as a pair of integers, so a run's recording grows by one
+ pair per change of stage rather than by a name per stage.  Compute lines
+ summarize the operation's wall times in seconds; each statistic is the
+ largest over the performer's ranks.
+ */
+/******************************************************************************/
+class StageRecorder
+{
+public:
+    StageRecorder();
+    ~StageRecorder();
+
+    void enable(const MPI_Comm & aComm, const std::string & aPerformerName, const std::string & aFileName);
+    bool isEnabled() const;
+
+    void recordOwnedIDs(Plato::data::layout_t aLayout, int aNumOwnedIDs);
+    // aSize is the length of values; fields are recorded by layout and number of components
+    void recordField(const std::string & aName, Plato::data::layout_t aLayout, int aSize, int aNumComponents = 1);
+    void recordDriver();
+    void recordStage(const std::string & aStageName, const std::vector<std::string> & aTransmits);
+    void recordCompute(const std::string & aOperationName, double aSeconds);
+
+    // collective over the recorder's communicator; writes the recording on rank 0
+    void finalize();
+
+private:
+    std::string serialize() const;
+
+    bool mIsEnabled;
+    bool mIsDriver;
+    MPI_Comm mComm;
+    std::string mPerformerName;
+    std::string mFileName;
+
+    std::map<std::string, int> mOwnedIDs;
+    std::vector<std::string> mFieldNames;
+    std::map<std::string, std::pair<std::string, int>> mFields; /*!< layout, and size or number of components */
+    std::vector<std::string> mStageNames;
+    std::map<std::string, int> mStageIndices;
+    std::vector<std::pair<int, int>> mStageRuns; /*!< index into mStageNames, repeat count */
+    std::map<std::string, std::vector<std::string>> mTransmits;
+    std::vector<std::string> mOperationNames;
+    std::map<std::string, Plato::ComputeTimes> mComputeTimes;
+
+private:
+    StageRecorder(const Plato::StageRecorder & aRhs);
+    Plato::StageRecorder & operator=(const Plato::StageRecorder & aRhs);
+};
+
+/******************************************************************************/
+//!  Stage traffic read back from a file written by StageRecorder
+/******************************************************************************/
+struct StageRecording
+{
+    struct Field
+    {
+        std::string mName;
+        std::string mLayout;
+        int mSize;
+    };
+
+    //! consecutive executions of the same stage
+    struct StageRun
+    {
+        std::string mName;
+        int mRepeats;
+    };
+
+    std::vector<std::string> mPerformerNames;
+    std::map<std::string, int> mPerformerRanks;
+    std::map<std::string, int> mGlobalIDs;
+    std::vector<Field> mFields;
+    std::string mDriver;
+    std::map<std::string, std::vector<std::string>> mTransmits;
+    std::vector<StageRun> mStages;
+    std::map<std::string, std::map<std::string, Plato::ComputeTimes>> mComputeTimes;
+
+    int numStages() const;
+    // throws Plato::ParsingException if the file can't be read or isn't a recording
+    void read(const std::string & aFileName);
+};
+
+}
@@ -0,0 +1,469 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Tracer.cpp
+ *
+ */
+
+#include "Plato_Tracer.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+namespace Plato
+{
+
+namespace
+{
+
+std::string escapeJSON(const std::string & aInput)
+{
+    std::string tOutput;
+    tOutput.reserve(aInput.size());
+    for(const char tChar : aInput)
+    {
+        if(tChar == '"' || tChar == '\\')
+        {
+            tOutput.push_back('\\');
+            tOutput.push_back(tChar);
+        }
+        else if(static_cast<unsigned char>(tChar) < 0x20)
+        {
+            tOutput.push_back(' ');
+        }
+        else
+        {
+            tOutput.push_back(tChar);
+        }
+    }
+    return tOutput;
+}
+
+std::string removeSeparators(const std::string & aInput)
+{
+    std::string tOutput(aInput);
+    std::replace(tOutput.begin(), tOutput.end(), '\t', ' ');
+    std::replace(tOutput.begin(), tOutput.end(), '\n', ' ');
+    return tOutput;
+}
+
+}
+
+/******************************************************************************/
+Tracer & Tracer::get()
+/******************************************************************************/
+{
+    static Plato::Tracer tTracer;
+    return tTracer;
+}
+
+/******************************************************************************/
+Tracer::Tracer() :
+        mIsEnabled(false),
+        mComm(MPI_COMM_NULL),
+        mRank(0),
+        mProcessID(0),
+        mProcessName(),
+        mFileName(),
+        mOrigin(0.0),
+        mNumEvents(0),
+        mMaxBufferedEvents(0),
+        mTraceFile(),
+        mTotals(),
+        mEvents(),
+        mOpenEvents()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+Tracer::~Tracer()
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+void Tracer::enable(const MPI_Comm & aComm,
+                    const std::string & aFileName,
+                    int aProcessID,
+                    const std::string & aProcessName,
+                    size_t aMaxBufferedEvents)
+/******************************************************************************/
+{
+    mComm = aComm;
+    MPI_Comm_rank(mComm, &mRank);
+    mProcessID = aProcessID;
+    mProcessName = aProcessName;
+    mFileName = aFileName;
+    mNumEvents = 0;
+    mMaxBufferedEvents = std::max(aMaxBufferedEvents, static_cast<size_t>(1));
+    mTotals.clear();
+    mEvents.clear();
+    mEvents.reserve(mMaxBufferedEvents);
+    mOpenEvents.clear();
+    this->openTrace();
+
+    // collective: all ranks share the same time origin
+    MPI_Barrier(mComm);
+    mOrigin = MPI_Wtime();
+    mIsEnabled = true;
+}
+
+/******************************************************************************/
+bool Tracer::isEnabled() const
+/******************************************************************************/
+{
+    return mIsEnabled;
+}
+
+/******************************************************************************/
+void Tracer::begin(const char* aCategory, const std::string & aName)
+/******************************************************************************/
+{
+    if(mIsEnabled == false)
+    {
+        return;
+    }
+
+    // the path is stored once, as the key of its totals
+    const std::string tPath = mOpenEvents.empty() ? aName : mOpenEvents.back().mPath->first + "/" + aName;
+    Event tEvent;
+    tEvent.mCategory = aCategory;
+    tEvent.mPath = mTotals.insert(std::make_pair(tPath, Totals())).first;
+    tEvent.mNameOffset = tPath.size() - aName.size();
+    tEvent.mBegin = MPI_Wtime() - mOrigin;
+    tEvent.mDuration = 0.0;
+    tEvent.mBytes = 0;
+
+    mOpenEvents.push_back(tEvent);
+    mNumEvents++;
+}
+
+/******************************************************************************/
+void Tracer::end(size_t aBytes)
+/******************************************************************************/
+{
+    if(mIsEnabled == false || mOpenEvents.empty())
+    {
+        return;
+    }
+
+    Event & tEvent = mOpenEvents.back();
+    tEvent.mDuration = MPI_Wtime() - mOrigin - tEvent.mBegin;
+    tEvent.mBytes += aBytes;
+
+    Totals & tMyTotals = tEvent.mPath->second;
+    if(tMyTotals.mCount == 0u)
+    {
+        tMyTotals.mCategory = tEvent.mCategory;
+    }
+    tMyTotals.mCount++;
+    tMyTotals.mBytes += tEvent.mBytes;
+    tMyTotals.mSumTime += tEvent.mDuration;
+
+    mEvents.push_back(tEvent);
+    mOpenEvents.pop_back();
+    if(mEvents.size() >= mMaxBufferedEvents)
+    {
+        this->flushTrace();
+    }
+}
+
+/******************************************************************************/
+size_t Tracer::getNumEvents() const
+/******************************************************************************/
+{
+    return mNumEvents;
+}
+
+/******************************************************************************/
+size_t Tracer::getNumBufferedEvents() const
+/******************************************************************************/
+{
+    return mEvents.size();
+}
+
+/******************************************************************************/
+void Tracer::finalize()
+/******************************************************************************/
+{
+    if(mIsEnabled == false)
+    {
+        return;
+    }
+
+    while(mOpenEvents.empty() == false)
+    {
+        this->end();
+    }
+
+    this->closeTrace();
+    this->writeSummary();
+
+    mIsEnabled = false;
+    mNumEvents = 0;
+    mTotals.clear();
+}
+
+/******************************************************************************/
+void Tracer::openTrace()
+/******************************************************************************/
+{
+    std::ostringstream tFileName;
+    tFileName << mFileName << "." << mRank << ".json";
+    if(mTraceFile.is_open())
+    {
+        mTraceFile.close();
+    }
+    mTraceFile.open(tFileName.str().c_str());
+
+    // Chrome trace event format: one process per performer, one thread per rank
+    mTraceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    mTraceFile << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << mProcessID << ",\"tid\":" << mRank
+               << ",\"args\":{\"name\":\"" << escapeJSON(mProcessName) << "\"}},\n";
+    mTraceFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << mProcessID << ",\"tid\":" << mRank
+               << ",\"args\":{\"name\":\"rank " << mRank << "\"}}";
+    mTraceFile << std::fixed << std::setprecision(3);
+}
+
+/******************************************************************************/
+void Tracer::flushTrace()
+/******************************************************************************/
+{
+    for(const Event & tEvent : mEvents)
+    {
+        const std::string & tPath = tEvent.mPath->first;
+        mTraceFile << ",\n{\"name\":\"" << escapeJSON(tPath.substr(tEvent.mNameOffset)) << "\",\"cat\":\""
+                   << tEvent.mCategory << "\",\"ph\":\"X\",\"pid\":" << mProcessID << ",\"tid\":" << mRank
+                   << ",\"ts\":" << 1.0e6 * tEvent.mBegin << ",\"dur\":" << 1.0e6 * tEvent.mDuration
+                   << ",\"args\":{\"path\":\"" << escapeJSON(tPath) << "\",\"bytes\":" << tEvent.mBytes << "}}";
+    }
+    mEvents.clear();
+}
+
+/******************************************************************************/
+void Tracer::closeTrace()
+/******************************************************************************/
+{
+    this->flushTrace();
+    mTraceFile << "\n]}\n";
+    mTraceFile.close();
+}
+
+/******************************************************************************/
+void Tracer::writeSummary()
+/******************************************************************************/
+{
+    std::string tSummary = this->getSummary();
+    if(mRank == 0)
+    {
+        std::ofstream tFile((mFileName + "_summary.txt").c_str());
+        tFile << tSummary;
+    }
+}
+
+/******************************************************************************/
+std::string Tracer::serializeTotals() const
+/******************************************************************************/
+{
+    std::map<std::string, Totals> tTotals;
+    for(const std::pair<const std::string, Totals> & tEntry : mTotals)
+    {
+        if(tEntry.second.mCount == 0u)
+        {
+            continue; // still open
+        }
+        Totals & tMyTotals = tTotals[removeSeparators(tEntry.first)];
+        if(tMyTotals.mCount == 0u)
+        {
+            tMyTotals.mCategory = tEntry.second.mCategory;
+        }
+        tMyTotals.mCount += tEntry.second.mCount;
+        tMyTotals.mBytes += tEntry.second.mBytes;
+        tMyTotals.mSumTime += tEntry.second.mSumTime;
+    }
+
+    std::ostringstream tOutput;
+    tOutput << std::setprecision(17);
+    for(const std::pair<const std::string, Totals> & tEntry : tTotals)
+    {
+        tOutput << tEntry.first << "\t" << tEntry.second.mCategory << "\t" << tEntry.second.mCount << "\t"
+                << tEntry.second.mSumTime << "\t" << tEntry.second.mBytes << "\n";
+    }
+    return tOutput.str();
+}
+
+/******************************************************************************/
+void Tracer::mergeTotals(const std::string & aSerialized, std::map<std::string, Totals> & aTotals) const
+/******************************************************************************/
+{
+    std::istringstream tInput(aSerialized);
+    std::string tLine;
+    while(std::getline(tInput, tLine))
+    {
+        std::istringstream tFields(tLine);
+        std::string tPath, tCategory, tCount, tTime, tBytes;
+        std::getline(tFields, tPath, '\t');
+        std::getline(tFields, tCategory, '\t');
+        std::getline(tFields, tCount, '\t');
+        std::getline(tFields, tTime, '\t');
+        std::getline(tFields, tBytes, '\t');
+
+        const double tMyTime = std::stod(tTime);
+        Totals & tMyTotals = aTotals[tPath];
+        if(tMyTotals.mNumRanks == 0)
+        {
+            tMyTotals.mCategory = tCategory;
+            tMyTotals.mMinTime = tMyTime;
+            tMyTotals.mMaxTime = tMyTime;
+        }
+        tMyTotals.mNumRanks++;
+        tMyTotals.mCount += std::stoul(tCount);
+        tMyTotals.mBytes += std::stoul(tBytes);
+        tMyTotals.mMinTime = std::min(tMyTotals.mMinTime, tMyTime);
+        tMyTotals.mMaxTime = std::max(tMyTotals.mMaxTime, tMyTime);
+        tMyTotals.mSumTime += tMyTime;
+    }
+}
+
+/******************************************************************************/
+std::string Tracer::getSummary()
+/******************************************************************************/
+{
+    // collective: gather each rank's totals on rank zero
+    std::string tLocal = this->serializeTotals();
+    int tLocalSize = tLocal.size();
+    int tNumRanks = 0;
+    MPI_Comm_size(mComm, &tNumRanks);
+
+    std::vector<int> tSizes(tNumRanks, 0);
+    MPI_Gather(&tLocalSize, 1, MPI_INT, tSizes.data(), 1, MPI_INT, 0, mComm);
+
+    std::vector<int> tOffsets(tNumRanks, 0);
+    for(int tIndex = 1; tIndex < tNumRanks; tIndex++)
+    {
+        tOffsets[tIndex] = tOffsets[tIndex - 1] + tSizes[tIndex - 1];
+    }
+    std::vector<char> tGathered(mRank == 0 ? tOffsets.back() + tSizes.back() + 1 : 1);
+    MPI_Gatherv(tLocal.data(), tLocalSize, MPI_CHAR, tGathered.data(), tSizes.data(), tOffsets.data(), MPI_CHAR, 0, mComm);
+
+    if(mRank != 0)
+    {
+        return std::string();
+    }
+
+    std::map<std::string, Totals> tTotals;
+    for(int tIndex = 0; tIndex < tNumRanks; tIndex++)
+    {
+        this->mergeTotals(std::string(tGathered.data() + tOffsets[tIndex], tSizes[tIndex]), tTotals);
+    }
+
+    const int tScopeWidth = 50;
+    const int tColumnWidth = 15;
+
+    std::ostringstream tOutput;
+    tOutput << "Plato Trace Summary (" << tNumRanks << " ranks):" << std::endl;
+    tOutput << std::left << std::setw(tScopeWidth) << "scope" << "|"
+            << std::setw(tColumnWidth) << "category" << "|"
+            << std::setw(tColumnWidth) << "ranks" << "|"
+            << std::setw(tColumnWidth) << "calls" << "|"
+            << std::setw(tColumnWidth) << "min seconds" << "|"
+            << std::setw(tColumnWidth) << "mean seconds" << "|"
+            << std::setw(tColumnWidth) << "max seconds" << "|"
+            << std::setw(tColumnWidth) << "max/mean" << "|"
+            << std::setw(tColumnWidth) << "bytes" << std::endl;
+
+    for(const std::pair<const std::string, Totals> & tEntry : tTotals)
+    {
+        // indent each scope under its parent
+        const size_t tSeparator = tEntry.first.find_last_of('/');
+        const size_t tDepth = std::count(tEntry.first.begin(), tEntry.first.end(), '/');
+        const std::string tName = tSeparator == std::string::npos ? tEntry.first : tEntry.first.substr(tSeparator + 1);
+
+        const Totals & tMyTotals = tEntry.second;
+        const double tMeanTime = tMyTotals.mSumTime / tMyTotals.mNumRanks;
+        const double tImbalance = tMeanTime > 0.0 ? tMyTotals.mMaxTime / tMeanTime : 1.0;
+        tOutput << std::left << std::setw(tScopeWidth) << (std::string(2 * tDepth, ' ') + tName) << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mCategory << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mNumRanks << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mCount << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mMinTime << "|"
+                << std::setw(tColumnWidth) << tMeanTime << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mMaxTime << "|"
+                << std::setw(tColumnWidth) << tImbalance << "|"
+                << std::setw(tColumnWidth) << tMyTotals.mBytes << std::endl;
+    }
+    return tOutput.str();
+}
+
+/******************************************************************************/
+TraceScope::TraceScope(const char* aCategory, const std::string & aName) :
+        mIsActive(Plato::Tracer::get().isEnabled()),
+        mBytes(0)
+/******************************************************************************/
+{
+    if(mIsActive)
+    {
+        Plato::Tracer::get().begin(aCategory, aName);
+    }
+}
+
+/******************************************************************************/
+TraceScope::~TraceScope()
+/******************************************************************************/
+{
+    if(mIsActive)
+    {
+        Plato::Tracer::get().end(mBytes);
+    }
+}
+
+/******************************************************************************/
+void TraceScope::addBytes(size_t aBytes)
+/******************************************************************************/
+{
+    mBytes += aBytes;
+}
+
+}
@@ -0,0 +1,169 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Tracer.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <fstream>
+#include <mpi.h>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace Plato
+{
+
+/******************************************************************************/
+//!  Hierarchical trace of stages, operations, and shared data transmits
+/*!
+ Scopes nest: each event is recorded with the path of the scopes that were open
+ when it began (e.g., "Objective/Compute Objective/compute").  The time, call
+ count, and bytes of each scope path are accumulated as events end, so memory
+ grows with the number of distinct paths, not with the number of calls.  Ended
+ events are buffered and appended to one Chrome trace (Perfetto compatible)
+ JSON file per rank whenever the buffer is full.  finalize() flushes the buffer
+ and writes a summary, merged over all ranks, that lists the time spent in each
+ scope path with its spread across ranks.
+
+ There is one tracer per process; it records nothing until enable() is called.
+ */
+/******************************************************************************/
+class Tracer
+{
+public:
+    static Plato::Tracer & get();
+
+    void enable(const MPI_Comm & aComm,
+                const std::string & aFileName,
+                int aProcessID,
+                const std::string & aProcessName,
+                size_t aMaxBufferedEvents = 4096);
+    bool isEnabled() const;
+
+    void begin(const char* aCategory, const std::string & aName);
+    void end(size_t aBytes = 0);
+
+    void finalize();
+
+    size_t getNumEvents() const;
+    size_t getNumBufferedEvents() const;
+    std::string getSummary();
+
+private:
+    Tracer();
+    ~Tracer();
+
+    struct Totals
+    {
+        std::string mCategory;
+        size_t mCount;
+        size_t mBytes;
+        int mNumRanks;
+        double mMinTime;
+        double mMaxTime;
+        double mSumTime;
+    };
+
+    typedef std::map<std::string, Totals>::iterator TotalsIterator;
+
+    struct Event
+    {
+        const char* mCategory;
+        TotalsIterator mPath;
+        size_t mNameOffset;
+        double mBegin;
+        double mDuration;
+        size_t mBytes;
+    };
+
+    void openTrace();
+    void flushTrace();
+    void closeTrace();
+    void writeSummary();
+    std::string serializeTotals() const;
+    void mergeTotals(const std::string & aSerialized, std::map<std::string, Totals> & aTotals) const;
+
+    bool mIsEnabled;
+    MPI_Comm mComm;
+    int mRank;
+    int mProcessID;
+    std::string mProcessName;
+    std::string mFileName;
+    double mOrigin;
+    size_t mNumEvents;
+    size_t mMaxBufferedEvents;
+    std::ofstream mTraceFile;
+    std::map<std::string, Totals> mTotals;
+    std::vector<Event> mEvents;
+    std::vector<Event> mOpenEvents;
+
+private:
+    Tracer(const Plato::Tracer & aRhs);
+    Plato::Tracer & operator=(const Plato::Tracer & aRhs);
+};
+
+/******************************************************************************/
+//!  Opens a trace scope on construction and closes it on destruction
+/******************************************************************************/
+class TraceScope
+{
+public:
+    TraceScope(const char* aCategory, const std::string & aName);
+    ~TraceScope();
+
+    void addBytes(size_t aBytes);
+
+private:
+    bool mIsActive;
+    size_t mBytes;
+
+private:
+    TraceScope(const Plato::TraceScope & aRhs);
+    Plato::TraceScope & operator=(const Plato::TraceScope & aRhs);
+};
+
+}
@@ -47,8 +47,14 @@
  */
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
 #include "Plato_InputData.hpp"
 #include "Plato_Parser.hpp"
+#include "Plato_Exceptions.hpp"
+#include "Plato_OptimizerEngineStageData.hpp"
 
 namespace PlatoTestInputData
 {
@@ -625,4 +631,174 @@ namespace PlatoTestInputData
     EXPECT_EQ( parameters[1].get<std::string>("ArgumentValue"), "-0.173648" );
   }
 
+  TEST(PlatoTestInputData, ViewMissingOrWrongType)
+  {
+    Plato::InputData inputData("Input Data");
+    EXPECT_EQ( inputData.view<std::string>("A"), nullptr );
+
+    inputData.add<std::string>("A", "first");
+    inputData.add<double>("B", 2.5);
+    ASSERT_NE( inputData.view<std::string>("A"), nullptr );
+    EXPECT_EQ( *inputData.view<std::string>("A"), "first" );
+    EXPECT_EQ( *inputData.view<double>("B"), 2.5 );
+
+    // wrong type, index past the end, or unknown name
+    EXPECT_EQ( inputData.view<double>("A"), nullptr );
+    EXPECT_EQ( inputData.view<Plato::InputData>("A"), nullptr );
+    EXPECT_EQ( inputData.view<std::string>("B"), nullptr );
+    EXPECT_EQ( inputData.view<std::string>("A", 1), nullptr );
+    EXPECT_EQ( inputData.view<std::string>("C"), nullptr );
+  }
+
+  TEST(PlatoTestInputData, ForEachInInsertionOrder)
+  {
+    Plato::InputData inputData("Input Data");
+    inputData.add<std::string>("Name", "c");
+    inputData.add<std::string>("Other", "x");
+    inputData.add<std::string>("Name", "a");
+    inputData.add<std::string>("Name", "b");
+
+    std::vector<std::string> names;
+    inputData.forEach<std::string>("Name", [&names](const std::string & name){ names.push_back(name); });
+    EXPECT_EQ( names, std::vector<std::string>({"c", "a", "b"}) );
+
+    // no entries of the requested type or name: the function isn't called
+    int numCalls = 0;
+    inputData.forEach<double>("Name", [&numCalls](const double &){ numCalls++; });
+    inputData.forEach<std::string>("Missing", [&numCalls](const std::string &){ numCalls++; });
+    EXPECT_EQ( numCalls, 0 );
+  }
+
+  TEST(PlatoTestInputData, MixedTypeAddThrows)
+  {
+    Plato::InputData inputData("Input Data");
+    inputData.add<std::string>("A", "1");
+    EXPECT_ANY_THROW( inputData.add<double>("A", 1.0) );
+    EXPECT_ANY_THROW( inputData.add<Plato::InputData>("A", Plato::InputData("Sub")) );
+
+    inputData.add<int>("B", 1);
+    EXPECT_ANY_THROW( inputData.add<double>("B", 1.0) );
+    EXPECT_ANY_THROW( inputData.add<std::string>("B", "1") );
+
+    // the failed adds left nothing behind
+    EXPECT_EQ( inputData.size<std::string>("A"), 1u );
+    EXPECT_EQ( inputData.size<double>("A"), 0u );
+    EXPECT_EQ( inputData.size<int>("B"), 1u );
+  }
+
+  TEST(PlatoTestInputData, SetAtIndex)
+  {
+    Plato::InputData inputData("Input Data");
+    inputData.add<std::string>("A", "a0");
+    inputData.add<std::string>("A", "a1");
+    inputData.add<std::string>("A", "a2");
+
+    inputData.set<std::string>("A", "b1", 1);
+    EXPECT_EQ( inputData.getByName<std::string>("A"), std::vector<std::string>({"a0", "b1", "a2"}) );
+
+    // one past the end appends; further is an error, as is another type
+    inputData.set<std::string>("A", "a3", 3);
+    EXPECT_EQ( inputData.get<std::string>("A", 3), "a3" );
+    EXPECT_ANY_THROW( inputData.set<std::string>("A", "a5", 5) );
+    EXPECT_ANY_THROW( inputData.set<double>("A", 1.0, 0) );
+    EXPECT_EQ( inputData.size<std::string>("A"), 4u );
+
+    // the same holds for values kept in a Plato::any
+    inputData.add<double>("B", 1.0);
+    inputData.add<double>("B", 2.0);
+    inputData.set<double>("B", 3.0, 1);
+    EXPECT_EQ( inputData.getByName<double>("B"), std::vector<double>({1.0, 3.0}) );
+  }
+
+  TEST(PlatoTestInputData, CopiesShareStorage)
+  {
+    Plato::InputData inputData("Input Data");
+    inputData.add<std::string>("A", "1");
+
+    Plato::InputData copy = inputData;
+    EXPECT_TRUE( copy == inputData );
+    copy.add<std::string>("A", "2");
+    copy.set<std::string>("A", "3", 0);
+    copy.add<double>("B", 4.0);
+    EXPECT_EQ( inputData.getByName<std::string>("A"), std::vector<std::string>({"3", "2"}) );
+    EXPECT_EQ( inputData.get<double>("B"), 4.0 );
+
+    // a sub InputData stored in a node is shared the same way
+    Plato::InputData subData("Sub");
+    inputData.add<Plato::InputData>("Sub", subData);
+    subData.add<std::string>("C", "5");
+    EXPECT_EQ( inputData.get<Plato::InputData>("Sub").get<std::string>("C"), "5" );
+
+    // a new InputData with the same name has its own storage
+    Plato::InputData other("Input Data");
+    EXPECT_FALSE( other == inputData );
+    EXPECT_EQ( other.size<std::string>("A"), 0u );
+  }
+
+  TEST(PlatoTestInputData, NamesInternedFromThreads)
+  {
+    const int numThreads = 4;
+    const int numNames = 200;
+    std::vector<int> numFound(numThreads, 0);
+    std::vector<std::thread> threads;
+    for( int t = 0; t < numThreads; t++ ){
+      threads.emplace_back([t, &numFound](){
+        Plato::InputData inputData("Thread " + std::to_string(t));
+        for( int n = 0; n < numNames; n++ ){
+          // half the names are shared between threads, half are new to each
+          const std::string name = n % 2 == 0 ? "Shared " + std::to_string(n) : "Thread " + std::to_string(t) + " " + std::to_string(n);
+          inputData.add<std::string>(name, std::to_string(n));
+        }
+        for( int n = 0; n < numNames; n++ ){
+          const std::string name = n % 2 == 0 ? "Shared " + std::to_string(n) : "Thread " + std::to_string(t) + " " + std::to_string(n);
+          const std::string* value = inputData.view<std::string>(name);
+          if( value != nullptr && *value == std::to_string(n) ){
+            numFound[t]++;
+          }
+        }
+      });
+    }
+    for( std::thread & thread : threads ){
+      thread.join();
+    }
+    for( int t = 0; t < numThreads; t++ ){
+      EXPECT_EQ( numFound[t], numNames );
+    }
+  }
+
+  TEST(PlatoTestInputData, MathExpression)
+  {
+    Plato::MathExpression tExpression("Scale*(1-exp(-Step/Rate))", {"Scale", "Step", "Rate"});
+    EXPECT_NEAR( tExpression.evaluate({2.0, 0.0, 10.0}), 0.0, 1e-12 );
+    EXPECT_NEAR( tExpression.evaluate({2.0, 10.0, 10.0}), 2.0*(1.0-std::exp(-1.0)), 1e-12 );
+
+    tExpression.setVariable("step", 20.0);
+    EXPECT_NEAR( tExpression.evaluate(), 2.0*(1.0-std::exp(-2.0)), 1e-12 );
+
+    EXPECT_THROW( tExpression.setVariable("Undefined", 1.0), Plato::ParsingException );
+    EXPECT_THROW( tExpression.evaluate({1.0}), Plato::ParsingException );
+    EXPECT_THROW( Plato::MathExpression("Scale*", {"Scale"}), Plato::ParsingException );
+  }
+
+  TEST(PlatoTestInputData, CheckpointOptionsNeedSupportingOptimizer)
+  {
+    Plato::InputData options("Options");
+    options.add<std::string>("CheckpointFrequency", "5");
+    options.add<std::string>("RestartFromCheckpoint", "true");
+
+    Plato::InputData supported("Optimizer");
+    supported.add<std::string>("Package", "KSBC");
+    supported.add<Plato::InputData>("Options", options);
+    Plato::OptimizerEngineStageData stageData;
+    Plato::Parse::parseOptimizerOptions(supported, stageData);
+    EXPECT_EQ( stageData.getCheckpointFrequency(), 5u );
+    EXPECT_TRUE( stageData.getRestartFromCheckpoint() );
+
+    Plato::InputData unsupported("Optimizer");
+    unsupported.add<std::string>("Package", "KSAL");
+    unsupported.add<Plato::InputData>("Options", options);
+    Plato::OptimizerEngineStageData otherStageData;
+    EXPECT_THROW( Plato::Parse::parseOptimizerOptions(unsupported, otherStageData), Plato::ParsingException );
+  }
+
 } // end PlatoTestInputData namespace